@@ -0,0 +1,355 @@
+#!/usr/bin/env python3
+"""
+Generate C++ header with perfect-hash atom and residue typing tables.
+
+This script reads the typing data in resources/config and generates a C++
+header with constexpr lookup tables. Each table is a minimal perfect hash
+(hash and displace): a name is hashed once to pick a bucket seed, hashed again
+with that seed to pick its slot, and compared against the single name stored
+there. Classification then needs no tree or hash-map lookup at runtime.
+
+Usage:
+    python cmake/generate_typing_tables.py [config_dir] [output_path]
+
+CMake integration:
+    This script is run automatically during build when the typing JSON changes.
+    See CMakeLists.txt for the custom command configuration.
+
+Files:
+    Input:  resources/config/standard_types.json
+            resources/config/modified_nucleotides.json
+    Output: include/x3dna/core/typing/typing_tables_generated.hpp
+"""
+
+import json
+import sys
+from pathlib import Path
+from datetime import datetime
+
+
+FNV_PRIME = 0x01000193
+
+# AtomLocation flag bits, in standard_types.json "atom_locations" order
+LOCATION_FLAGS = {
+    'backbone': 'ATOM_BACKBONE',
+    'sugar': 'ATOM_SUGAR',
+    'ring': 'ATOM_RING',
+    'mainchain': 'ATOM_MAINCHAIN',
+}
+
+BASE_TYPES = {'ADENINE', 'CYTOSINE', 'GUANINE', 'THYMINE', 'URACIL', 'INOSINE', 'PSEUDOURIDINE'}
+
+
+def name_hash(seed: int, name: str) -> int:
+    """Hash matching tables::name_hash() in the generated header."""
+    h = seed if seed else FNV_PRIME
+    for c in name.encode():
+        h = ((h * FNV_PRIME) & 0xFFFFFFFF) ^ c
+    return h
+
+
+def build_perfect_hash(names: list) -> tuple:
+    """
+    Build a minimal perfect hash over names.
+
+    Returns (seeds, slots): seeds[bucket] is either a hash seed (>= 0) or
+    -(slot + 1) for single-name buckets; slots[i] is the name stored at slot i.
+    """
+    n = len(names)
+    buckets = [[] for _ in range(n)]
+    for name in names:
+        buckets[name_hash(0, name) % n].append(name)
+
+    seeds = [0] * n
+    slots = [None] * n
+    order = sorted(range(n), key=lambda b: -len(buckets[b]))
+
+    # Place multi-name buckets first by searching for a seed that spreads them over free slots
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        placed = []
+        while len(placed) < len(bucket):
+            slot = name_hash(seed, bucket[len(placed)]) % n
+            if slots[slot] is not None or slot in placed:
+                seed += 1
+                placed = []
+            else:
+                placed.append(slot)
+        if seed >= 2**31:
+            raise RuntimeError('perfect hash seed overflow')
+        seeds[b] = seed
+        for name, slot in zip(bucket, placed):
+            slots[slot] = name
+
+    # Single-name buckets point straight at a free slot
+    free = [i for i in range(n) if slots[i] is None]
+    for b in order:
+        if len(buckets[b]) == 1:
+            slot = free.pop()
+            seeds[b] = -slot - 1
+            slots[slot] = buckets[b][0]
+
+    return seeds, slots
+
+
+def cpp_string(s: str) -> str:
+    """Convert Python string to C++ string literal."""
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def cpp_char(c: str) -> str:
+    """Convert single character to C++ char literal."""
+    return "'\\''" if c == "'" else f"'{c}'"
+
+
+def load_atoms(standard: dict) -> dict:
+    """Collect per-name atom types and location flags."""
+    atoms = {}
+    for molecule, key in (('nucleotide', 'nucleotide_type'), ('protein', 'protein_type'), ('water', 'water_type')):
+        for name, atom_type in standard['atom_types'][molecule].items():
+            atoms.setdefault(name, {})[key] = atom_type
+    for location, names in standard['atom_locations'].items():
+        for name in names:
+            atoms.setdefault(name, {}).setdefault('locations', []).append(LOCATION_FLAGS[location])
+    return atoms
+
+
+def load_residues(standard: dict, nucleotides: dict) -> tuple:
+    """Collect per-name residue data; returns (residues, nucleotide_count)."""
+    residues = {}
+    for name in standard['waters']:
+        residues.setdefault(name, {})['water'] = True
+
+    # TypeRegistry iterates the nlohmann object in key order, so later categories win on duplicates
+    nucleotide_names = set()
+    for category in sorted(nucleotides['modified_nucleotides']):
+        entries = nucleotides['modified_nucleotides'][category]
+        for name in sorted(entries):
+            info = entries[name]
+            code = info['code'][0] if info['code'] else '?'
+            base_type = info['type'] if info['type'] in BASE_TYPES else 'UNKNOWN'
+            residues.setdefault(name, {})['nucleotide'] = (code, base_type, info['is_purine'])
+            nucleotide_names.add(name)
+
+    for name, info in standard['amino_acids'].items():
+        residues.setdefault(name, {})['amino_acid'] = (info['code'], info['category'])
+    for name, ion_type in standard['ions'].items():
+        residues.setdefault(name, {})['ion'] = ion_type
+    return residues, len(nucleotide_names)
+
+
+def format_seeds(seeds: list) -> list:
+    """Format a seed array, ten values per line."""
+    lines = []
+    for i in range(0, len(seeds), 10):
+        lines.append('    ' + ', '.join(str(s) for s in seeds[i:i + 10]) + ',')
+    return lines
+
+
+def generate_header(standard: dict, nucleotides: dict, timestamp: str = None) -> str:
+    """Generate C++ header content."""
+
+    if timestamp is None:
+        timestamp = datetime.now().isoformat()
+
+    atoms = load_atoms(standard)
+    residues, nucleotide_count = load_residues(standard, nucleotides)
+    atom_seeds, atom_slots = build_perfect_hash(sorted(atoms))
+    residue_seeds, residue_slots = build_perfect_hash(sorted(residues))
+
+    lines = [
+        "/**",
+        " * @file typing_tables_generated.hpp",
+        " * @brief Auto-generated perfect-hash atom and residue typing tables",
+        " *",
+        f" * Generated: {timestamp}",
+        " * Source: resources/config/standard_types.json, resources/config/modified_nucleotides.json",
+        " *",
+        " * DO NOT EDIT THIS FILE DIRECTLY!",
+        " * Edit the JSON files and rebuild (CMake runs generate_typing_tables.py automatically)",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "#include <x3dna/core/typing/atom_type.hpp>",
+        "#include <x3dna/core/typing/nucleotide_type.hpp>",
+        "#include <x3dna/core/typing/protein_type.hpp>",
+        "#include <x3dna/core/typing/solvent_type.hpp>",
+        "",
+        "namespace x3dna {",
+        "namespace core {",
+        "namespace typing {",
+        "namespace tables {",
+        "",
+        "/// Seeded FNV-1 hash shared by all tables (seed 0 selects the bucket)",
+        "constexpr uint32_t name_hash(uint32_t seed, std::string_view name) {",
+        f"    uint32_t h = seed != 0 ? seed : 0x{FNV_PRIME:08x}u;",
+        "    for (char c : name) {",
+        f"        h = (h * 0x{FNV_PRIME:08x}u) ^ static_cast<unsigned char>(c);",
+        "    }",
+        "    return h;",
+        "}",
+        "",
+        "/// Slot of a name: the bucket seed either rehashes the name or names the slot directly",
+        "template <size_t N>",
+        "constexpr size_t perfect_hash_slot(const int32_t (&seeds)[N], std::string_view name) {",
+        "    const int32_t seed = seeds[name_hash(0, name) % N];",
+        "    return seed < 0 ? static_cast<size_t>(-seed - 1) : name_hash(static_cast<uint32_t>(seed), name) % N;",
+        "}",
+        "",
+        "// Atom location flags",
+    ]
+    for bit, flag in enumerate(LOCATION_FLAGS.values()):
+        lines.append(f"constexpr uint8_t {flag} = {1 << bit};")
+
+    lines.extend([
+        "",
+        "/// Atom types of one trimmed atom name, per molecule type",
+        "struct AtomNameEntry {",
+        "    std::string_view name;",
+        "    AtomType nucleotide_type;",
+        "    AtomType protein_type;",
+        "    AtomType water_type;",
+        "    uint8_t locations;",
+        "};",
+        "",
+        f"constexpr size_t ATOM_NAME_COUNT = {len(atom_slots)};",
+        "",
+        "constexpr int32_t ATOM_NAME_SEEDS[ATOM_NAME_COUNT] = {",
+    ])
+    lines.extend(format_seeds(atom_seeds))
+    lines.extend([
+        "};",
+        "",
+        "constexpr AtomNameEntry ATOM_NAMES[ATOM_NAME_COUNT] = {",
+    ])
+    for name in atom_slots:
+        atom = atoms[name]
+        flags = ' | '.join(atom.get('locations', [])) or '0'
+        lines.append(f"    {{{cpp_string(name)}, AtomType::{atom.get('nucleotide_type', 'UNKNOWN')}, "
+                     f"AtomType::{atom.get('protein_type', 'UNKNOWN')}, AtomType::{atom.get('water_type', 'UNKNOWN')}, "
+                     f"{flags}}},")
+    lines.extend([
+        "};",
+        "",
+        "/// Entry for an atom name, or nullptr if no table lists it",
+        "constexpr const AtomNameEntry* find_atom_name(std::string_view name) {",
+        "    const AtomNameEntry& entry = ATOM_NAMES[perfect_hash_slot(ATOM_NAME_SEEDS, name)];",
+        "    return entry.name == name ? &entry : nullptr;",
+        "}",
+        "",
+        "// Residue kind flags",
+        "constexpr uint8_t RESIDUE_WATER = 1;",
+        "constexpr uint8_t RESIDUE_NUCLEOTIDE = 2;",
+        "constexpr uint8_t RESIDUE_AMINO_ACID = 4;",
+        "constexpr uint8_t RESIDUE_ION = 8;",
+        "",
+        "/// Everything the typing JSON says about one residue name; fields of absent kinds are defaults",
+        "struct ResidueNameEntry {",
+        "    std::string_view name;",
+        "    uint8_t kinds;",
+        "    char nucleotide_code;",
+        "    BaseType base_type;",
+        "    bool is_purine;",
+        "    char amino_acid_code;",
+        "    AminoAcidType amino_acid_type;",
+        "    AminoAcidCategory amino_acid_category;",
+        "    IonType ion_type;",
+        "};",
+        "",
+        "/// Number of names in modified_nucleotides.json",
+        f"constexpr size_t NUCLEOTIDE_COUNT = {nucleotide_count};",
+        "",
+        f"constexpr size_t RESIDUE_NAME_COUNT = {len(residue_slots)};",
+        "",
+        "constexpr int32_t RESIDUE_NAME_SEEDS[RESIDUE_NAME_COUNT] = {",
+    ])
+    lines.extend(format_seeds(residue_seeds))
+    lines.extend([
+        "};",
+        "",
+        "constexpr ResidueNameEntry RESIDUE_NAMES[RESIDUE_NAME_COUNT] = {",
+    ])
+    for name in residue_slots:
+        residue = residues[name]
+        kinds = []
+        if 'water' in residue:
+            kinds.append('RESIDUE_WATER')
+        if 'nucleotide' in residue:
+            kinds.append('RESIDUE_NUCLEOTIDE')
+        if 'amino_acid' in residue:
+            kinds.append('RESIDUE_AMINO_ACID')
+        if 'ion' in residue:
+            kinds.append('RESIDUE_ION')
+        code, base_type, is_purine = residue.get('nucleotide', ('?', 'UNKNOWN', False))
+        aa_code, aa_category = residue.get('amino_acid', ('?', 'UNKNOWN'))
+        aa_type = name if 'amino_acid' in residue else 'UNKNOWN'
+        lines.append(f"    {{{cpp_string(name)}, {' | '.join(kinds)}, {cpp_char(code)}, BaseType::{base_type}, "
+                     f"{'true' if is_purine else 'false'},")
+        lines.append(f"     {cpp_char(aa_code)}, AminoAcidType::{aa_type}, AminoAcidCategory::{aa_category}, "
+                     f"IonType::{residue.get('ion', 'UNKNOWN')}}},")
+    lines.extend([
+        "};",
+        "",
+        "/// Entry for a residue name, or nullptr if no table lists it",
+        "constexpr const ResidueNameEntry* find_residue_name(std::string_view name) {",
+        "    const ResidueNameEntry& entry = RESIDUE_NAMES[perfect_hash_slot(RESIDUE_NAME_SEEDS, name)];",
+        "    return entry.name == name ? &entry : nullptr;",
+        "}",
+        "",
+        "} // namespace tables",
+        "} // namespace typing",
+        "} // namespace core",
+        "} // namespace x3dna",
+        "",
+    ])
+
+    return '\n'.join(lines)
+
+
+def main():
+    # Support being called with explicit paths (for CMake)
+    if len(sys.argv) == 3:
+        config_dir = Path(sys.argv[1])
+        output_path = Path(sys.argv[2])
+    else:
+        # Fallback: script is in cmake/, project root is parent
+        script_dir = Path(__file__).parent
+        project_root = script_dir.parent
+        config_dir = project_root / "resources" / "config"
+        output_path = project_root / "include" / "x3dna" / "core" / "typing" / "typing_tables_generated.hpp"
+
+    # Load JSON
+    with open(config_dir / "standard_types.json") as f:
+        standard = json.load(f)
+    with open(config_dir / "modified_nucleotides.json") as f:
+        nucleotides = json.load(f)
+
+    # Generate header
+    header = generate_header(standard, nucleotides)
+
+    # Only write if content changed (avoid unnecessary rebuilds)
+    if output_path.exists():
+        existing = output_path.read_text()
+        # Compare ignoring timestamp line
+        new_lines = [l for l in header.split('\n') if not l.startswith(' * Generated:')]
+        old_lines = [l for l in existing.split('\n') if not l.startswith(' * Generated:')]
+        if new_lines == old_lines:
+            print(f"No changes to {output_path}")
+            return
+
+    output_path.parent.mkdir(parents=True, exist_ok=True)
+    with open(output_path, 'w') as f:
+        f.write(header)
+
+    print(f"Generated: {output_path}")
+
+
+if __name__ == "__main__":
+    main()
@@ -73,6 +73,11 @@ public:
     /**
      * @brief Calculate frames for all residues in a structure
      * @param structure Structure to calculate frames for (residues will be modified)
+     *
+     * Atoms are matched residue by residue, sharded over num_threads() threads;
+     * the bases are then fitted together with LeastSquaresFitter::fit_batch and
+     * the frames written back in legacy order. Frames equal those of
+     * calculate_frame for any thread count.
      */
     void calculate_all_frames(core::Structure& structure);
 
@@ -130,8 +135,27 @@ public:
      */
     [[nodiscard]] static bool detect_rna(const core::Structure& structure);
 
+    /**
+     * @brief Set the number of threads used by calculate_all_frames
+     * @param num_threads Thread count (1 = serial, 0 = hardware concurrency)
+     */
+    void set_num_threads(int num_threads) {
+        num_threads_ = num_threads;
+    }
+
+    /**
+     * @brief Get the configured thread count
+     */
+    [[nodiscard]] int num_threads() const {
+        return num_threads_;
+    }
+
 private:
     mutable StandardBaseTemplates templates_; // Mutable for caching (doesn't affect logical constness)
+    int num_threads_ = 1;
+
+    // Residues matched per parallel task in calculate_all_frames
+    static constexpr size_t RESIDUES_PER_TASK = 16;
     bool is_rna_ = false;
     bool legacy_mode_ = false; // If true, exclude C4 atom to match legacy behavior
 
@@ -141,6 +165,17 @@ private:
      * @return FrameCalculationResult
      */
     [[nodiscard]] FrameCalculationResult calculate_frame_impl(const core::Residue& residue) const;
+
+    /**
+     * @brief Everything calculate_frame_impl does before the fit
+     * @return Result with template, matched atoms and coordinates; no matched coordinates if the residue has no frame
+     */
+    [[nodiscard]] FrameCalculationResult match_frame_atoms(const core::Residue& residue) const;
+
+    /**
+     * @brief Store a fit in a matched result and mark it valid
+     */
+    static void apply_fit(FrameCalculationResult& result, const geometry::LeastSquaresFitter::FitResult& fit_result);
 };
 
 } // namespace algorithms
@@ -0,0 +1,61 @@
+/**
+ * @file angle_reference_table.hpp
+ * @brief Per-residue angle reference atoms for H-bond geometry
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <x3dna/core/residue.hpp>
+
+namespace x3dna {
+namespace algorithms {
+namespace hydrogen_bond {
+
+/**
+ * @brief Angle reference atom of every atom of one residue, by atom index
+ *
+ * The reference of an H-bond atom is the atom HBondGeometry::get_neighbor_atom_name
+ * names for it, resolved once so that residues reused across many pairs need no
+ * name searches per bond. Holds indices, so it stays valid for copies of the residue.
+ */
+class AngleReferenceTable {
+public:
+    AngleReferenceTable() = default;
+
+    /**
+     * @brief Build the table for a residue
+     */
+    explicit AngleReferenceTable(const core::Residue& residue);
+
+    /**
+     * @brief Number of atoms covered (residue atom count when built)
+     */
+    [[nodiscard]] size_t size() const {
+        return references_.size();
+    }
+
+    /**
+     * @brief Reference atom for the angle at an H-bond atom
+     * @return Atom index, or nullopt if the atom has no reference atom in this residue
+     */
+    [[nodiscard]] std::optional<size_t> angle_reference(size_t atom_idx) const {
+        const uint32_t reference = references_[atom_idx];
+        if (reference == NO_ATOM) {
+            return std::nullopt;
+        }
+        return reference;
+    }
+
+private:
+    static constexpr uint32_t NO_ATOM = UINT32_MAX;
+
+    std::vector<uint32_t> references_;
+};
+
+} // namespace hydrogen_bond
+} // namespace algorithms
+} // namespace x3dna
@@ -0,0 +1,284 @@
+/**
+ * @file atom_type_tables.hpp
+ * @brief Compile-time donor/acceptor role and Leontis-Westhof edge tables indexed by AtomType
+ *
+ * Same contents as the name-based lists in role_classifier.cpp, edge_classifier.cpp
+ * and BasePairValidator::donor_acceptor, keyed by (base, AtomType) so an H-bond atom
+ * is classified with two array reads. Atoms the tables cannot answer for
+ * (see uses_atom_type_tables) go through the name-based paths.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <x3dna/algorithms/hydrogen_bond/hbond_types.hpp>
+#include <x3dna/core/atom.hpp>
+#include <x3dna/core/typing/atom_type.hpp>
+
+namespace x3dna {
+namespace algorithms {
+namespace hydrogen_bond {
+
+namespace atom_type_tables {
+
+using core::BaseEdge;
+using core::HBondAtomRole;
+using core::typing::AtomType;
+
+constexpr size_t NUM_ATOM_TYPES = static_cast<size_t>(AtomType::COUNT);
+
+/// Legacy base list "ACGITU"; UNKNOWN_BASE indexes the row for any other base
+constexpr size_t NUM_LEGACY_BASES = 6;
+constexpr size_t UNKNOWN_BASE = NUM_LEGACY_BASES;
+
+/// Edge table bases "ACGUT"
+constexpr size_t NUM_EDGE_BASES = 5;
+
+/**
+ * @brief Index of a base in the legacy list "ACGITU" (case-insensitive)
+ * @return 0-5, or UNKNOWN_BASE
+ */
+[[nodiscard]] constexpr size_t legacy_base_index(char base) {
+    switch (base) {
+        case 'A':
+        case 'a':
+            return 0;
+        case 'C':
+        case 'c':
+            return 1;
+        case 'G':
+        case 'g':
+            return 2;
+        case 'I':
+        case 'i':
+            return 3;
+        case 'T':
+        case 't':
+            return 4;
+        case 'U':
+        case 'u':
+            return 5;
+        default:
+            return UNKNOWN_BASE;
+    }
+}
+
+/**
+ * @brief Index of a base in the edge table bases "ACGUT" (case-insensitive)
+ * @return 0-4, or NUM_EDGE_BASES for bases without edges (including I)
+ */
+[[nodiscard]] constexpr size_t edge_base_index(char base) {
+    switch (base) {
+        case 'A':
+        case 'a':
+            return 0;
+        case 'C':
+        case 'c':
+            return 1;
+        case 'G':
+        case 'g':
+            return 2;
+        case 'U':
+        case 'u':
+            return 3;
+        case 'T':
+        case 't':
+            return 4;
+        default:
+            return NUM_EDGE_BASES;
+    }
+}
+
+struct AtomRole {
+    AtomType type;
+    char role; // Legacy role: 'D' donor, 'A' acceptor, 'X' backbone either, '?' glycosidic either
+};
+
+struct AtomEdge {
+    AtomType type;
+    BaseEdge edge;
+};
+
+// Legacy bb_da list; OP1/OP2 stand for the legacy spellings O1P/O2P
+constexpr AtomRole BACKBONE_ROLES[] = {{AtomType::OP1, 'A'},      {AtomType::OP2, 'A'},
+                                       {AtomType::O5_PRIME, 'A'}, {AtomType::O4_PRIME, 'A'},
+                                       {AtomType::O3_PRIME, 'A'}, {AtomType::O2_PRIME, 'X'}};
+
+// Legacy base_da lists, in "ACGITU" order
+constexpr AtomRole ADENINE_ROLES[] = {
+    {AtomType::N9, '?'}, {AtomType::N7, 'A'}, {AtomType::N6, 'D'}, {AtomType::N1, 'A'}, {AtomType::N3, 'A'}};
+constexpr AtomRole CYTOSINE_ROLES[] = {
+    {AtomType::N1, '?'}, {AtomType::O2, 'A'}, {AtomType::N3, 'A'}, {AtomType::N4, 'D'}};
+constexpr AtomRole GUANINE_ROLES[] = {{AtomType::N9, '?'}, {AtomType::N7, 'A'}, {AtomType::O6, 'A'},
+                                      {AtomType::N1, 'D'}, {AtomType::N2, 'D'}, {AtomType::N3, 'A'}};
+constexpr AtomRole INOSINE_ROLES[] = {
+    {AtomType::N9, '?'}, {AtomType::N7, 'A'}, {AtomType::O6, 'A'}, {AtomType::N1, 'D'}, {AtomType::N3, 'A'}};
+constexpr AtomRole THYMINE_URACIL_ROLES[] = {
+    {AtomType::N1, '?'}, {AtomType::O2, 'A'}, {AtomType::N3, 'D'}, {AtomType::O4, 'A'}};
+
+// Leontis-Westhof edges, in "ACGUT" order
+constexpr AtomEdge ADENINE_EDGES[] = {
+    {AtomType::N1, BaseEdge::WATSON},    {AtomType::C2, BaseEdge::WATSON}, {AtomType::N6, BaseEdge::WATSON},
+    {AtomType::N7, BaseEdge::HOOGSTEEN}, {AtomType::C8, BaseEdge::HOOGSTEEN}, {AtomType::N3, BaseEdge::SUGAR},
+    {AtomType::C4, BaseEdge::SUGAR},     {AtomType::O2_PRIME, BaseEdge::SUGAR}};
+constexpr AtomEdge CYTOSINE_EDGES[] = {
+    {AtomType::N3, BaseEdge::WATSON},    {AtomType::C4, BaseEdge::WATSON},    {AtomType::N4, BaseEdge::WATSON},
+    {AtomType::C5, BaseEdge::HOOGSTEEN}, {AtomType::C6, BaseEdge::HOOGSTEEN}, {AtomType::O2, BaseEdge::SUGAR},
+    {AtomType::N1, BaseEdge::SUGAR},     {AtomType::O2_PRIME, BaseEdge::SUGAR}};
+constexpr AtomEdge GUANINE_EDGES[] = {
+    {AtomType::N1, BaseEdge::WATSON},    {AtomType::C2, BaseEdge::WATSON},    {AtomType::O6, BaseEdge::WATSON},
+    {AtomType::N7, BaseEdge::HOOGSTEEN}, {AtomType::C8, BaseEdge::HOOGSTEEN}, {AtomType::N2, BaseEdge::SUGAR},
+    {AtomType::N3, BaseEdge::SUGAR},     {AtomType::C4, BaseEdge::SUGAR},     {AtomType::O2_PRIME, BaseEdge::SUGAR}};
+constexpr AtomEdge URACIL_EDGES[] = {
+    {AtomType::N3, BaseEdge::WATSON},    {AtomType::C4, BaseEdge::WATSON},    {AtomType::O4, BaseEdge::WATSON},
+    {AtomType::C5, BaseEdge::HOOGSTEEN}, {AtomType::C6, BaseEdge::HOOGSTEEN}, {AtomType::O2, BaseEdge::SUGAR},
+    {AtomType::N1, BaseEdge::SUGAR},     {AtomType::O2_PRIME, BaseEdge::SUGAR}};
+constexpr AtomEdge THYMINE_EDGES[] = {
+    {AtomType::N3, BaseEdge::WATSON},    {AtomType::C4, BaseEdge::WATSON},    {AtomType::O4, BaseEdge::WATSON},
+    {AtomType::C5, BaseEdge::HOOGSTEEN}, {AtomType::C6, BaseEdge::HOOGSTEEN}, {AtomType::O2, BaseEdge::SUGAR},
+    {AtomType::N1, BaseEdge::SUGAR}}; // DNA has no O2'
+
+/**
+ * @brief Element-based role of a nucleotide atom type (HBondRoleClassifier::get_element_based_role)
+ */
+[[nodiscard]] constexpr HBondAtomRole element_role(AtomType type) {
+    switch (type) {
+        case AtomType::N3:
+        case AtomType::N1:
+        case AtomType::N7:
+        case AtomType::N9:
+        case AtomType::O6:
+        case AtomType::N6:
+        case AtomType::O2:
+        case AtomType::N2:
+        case AtomType::O4:
+        case AtomType::N4:
+        case AtomType::O2_PRIME:
+        case AtomType::O3_PRIME:
+        case AtomType::O4_PRIME:
+        case AtomType::O5_PRIME:
+        case AtomType::OP1:
+        case AtomType::OP2:
+        case AtomType::OP3:
+            return HBondAtomRole::EITHER;
+        default:
+            return HBondAtomRole::UNKNOWN;
+    }
+}
+
+[[nodiscard]] constexpr HBondAtomRole role_from_char(char role) {
+    switch (role) {
+        case 'D':
+            return HBondAtomRole::DONOR;
+        case 'A':
+            return HBondAtomRole::ACCEPTOR;
+        case '?':
+        case 'X':
+            return HBondAtomRole::EITHER;
+        default:
+            return HBondAtomRole::UNKNOWN;
+    }
+}
+
+template <size_t N>
+constexpr void fill_roles(std::array<char, NUM_ATOM_TYPES>& row, const AtomRole (&roles)[N]) {
+    for (const auto& entry : roles) {
+        row[static_cast<size_t>(entry.type)] = entry.role;
+    }
+}
+
+template <size_t N>
+constexpr void fill_edges(std::array<BaseEdge, NUM_ATOM_TYPES>& row, const AtomEdge (&edges)[N]) {
+    for (const auto& entry : edges) {
+        row[static_cast<size_t>(entry.type)] = entry.edge;
+    }
+}
+
+[[nodiscard]] constexpr std::array<std::array<char, NUM_ATOM_TYPES>, NUM_LEGACY_BASES> make_legacy_roles() {
+    std::array<std::array<char, NUM_ATOM_TYPES>, NUM_LEGACY_BASES> table{};
+    for (auto& row : table) {
+        fill_roles(row, BACKBONE_ROLES);
+    }
+    fill_roles(table[0], ADENINE_ROLES);
+    fill_roles(table[1], CYTOSINE_ROLES);
+    fill_roles(table[2], GUANINE_ROLES);
+    fill_roles(table[3], INOSINE_ROLES);
+    fill_roles(table[4], THYMINE_URACIL_ROLES);
+    fill_roles(table[5], THYMINE_URACIL_ROLES);
+    return table;
+}
+
+/**
+ * @brief Legacy role character by [legacy base index][AtomType]; '\0' where the legacy lists have no entry
+ */
+constexpr auto LEGACY_ROLES = make_legacy_roles();
+
+[[nodiscard]] constexpr std::array<std::array<HBondAtomRole, NUM_ATOM_TYPES>, NUM_LEGACY_BASES + 1> make_roles() {
+    std::array<std::array<HBondAtomRole, NUM_ATOM_TYPES>, NUM_LEGACY_BASES + 1> table{};
+    std::array<char, NUM_ATOM_TYPES> backbone{};
+    fill_roles(backbone, BACKBONE_ROLES);
+    for (size_t b = 0; b <= NUM_LEGACY_BASES; ++b) {
+        for (size_t t = 0; t < NUM_ATOM_TYPES; ++t) {
+            const char role = b < NUM_LEGACY_BASES ? LEGACY_ROLES[b][t] : backbone[t];
+            table[b][t] = role != '\0' ? role_from_char(role) : element_role(static_cast<AtomType>(t));
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Donor/acceptor role by [legacy base index or UNKNOWN_BASE][AtomType]
+ *
+ * Matches HBondRoleClassifier::get_nucleotide_atom_role, including its element fallback.
+ */
+constexpr auto ROLES = make_roles();
+
+[[nodiscard]] constexpr std::array<std::array<BaseEdge, NUM_ATOM_TYPES>, NUM_EDGE_BASES> make_edges() {
+    std::array<std::array<BaseEdge, NUM_ATOM_TYPES>, NUM_EDGE_BASES> table{};
+    for (auto& row : table) {
+        for (auto& edge : row) {
+            edge = BaseEdge::UNKNOWN;
+        }
+    }
+    fill_edges(table[0], ADENINE_EDGES);
+    fill_edges(table[1], CYTOSINE_EDGES);
+    fill_edges(table[2], GUANINE_EDGES);
+    fill_edges(table[3], URACIL_EDGES);
+    fill_edges(table[4], THYMINE_EDGES);
+    return table;
+}
+
+/**
+ * @brief Leontis-Westhof edge by [edge base index][AtomType]
+ */
+constexpr auto EDGES = make_edges();
+
+static_assert(LEGACY_ROLES[2][static_cast<size_t>(AtomType::N2)] == 'D', "guanine N2 is a donor");
+static_assert(ROLES[UNKNOWN_BASE][static_cast<size_t>(AtomType::O2_PRIME)] == HBondAtomRole::EITHER,
+              "backbone roles apply to unknown bases");
+static_assert(EDGES[0][static_cast<size_t>(AtomType::N7)] == BaseEdge::HOOGSTEEN, "adenine N7 is Hoogsteen");
+
+/**
+ * @brief Whether an atom can be classified from the tables
+ *
+ * Requires a nucleotide AtomType. The phosphate oxygens must use the legacy
+ * spelling O1P/O2P, which the parsers produce: the legacy lists do not know
+ * OP1/OP2, although both spellings map to AtomType::OP1/OP2.
+ */
+[[nodiscard]] inline bool uses_atom_type_tables(const core::Atom& atom) {
+    const AtomType type = atom.atom_type();
+    if (type == AtomType::UNKNOWN || type > AtomType::OP3) {
+        return false;
+    }
+    if (type == AtomType::OP1 || type == AtomType::OP2) {
+        return atom.name().size() > 1 && atom.name()[1] != 'P';
+    }
+    return true;
+}
+
+} // namespace atom_type_tables
+
+} // namespace hydrogen_bond
+} // namespace algorithms
+} // namespace x3dna
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <vector>
+#include <x3dna/algorithms/hydrogen_bond/angle_reference_table.hpp>
 #include <x3dna/algorithms/hydrogen_bond/hbond.hpp>
 #include <x3dna/algorithms/hydrogen_bond/hbond_types.hpp>
 #include <x3dna/core/residue.hpp>
@@ -32,6 +33,28 @@ struct HBondPipelineResult {
     int good_bond_count = 0;     // Count in good distance range [2.5, 3.5]
 };
 
+/**
+ * @brief H-bond capable atoms of one residue, precomputed for repeated pair scans
+ *
+ * Built by HBondDetector::index_atoms. Holds atom indices (not pointers), so it
+ * stays valid for copies of the residue. Only valid with detectors that share
+ * the allowed_elements of the detector that built it.
+ */
+struct HBondAtomIndex {
+    struct PolarAtom {
+        size_t atom_idx = 0;      // Index in residue.atoms()
+        bool is_o_or_n = false;   // Legacy element index is O or N
+        bool legacy_base = false; // Legacy is_base_atom
+        bool nucleobase = false;  // AtomClassifier::is_nucleobase_atom
+        bool o2_prime = false;    // O2' by AtomType
+        bool po_list = false;     // In the legacy good_hbatoms PO list
+    };
+
+    std::vector<PolarAtom> polar_atoms; // Atoms with an allowed element, in residue order
+    std::vector<size_t> o2_prime_atoms; // All O2' atoms (by AtomType)
+    size_t num_atoms = 0;               // Residue atom count when built
+};
+
 /**
  * @brief H-bonds grouped by residue pair
  */
@@ -49,10 +72,57 @@ struct ResidueHBonds {
 struct StructureHBondResult {
     std::vector<ResidueHBonds> residue_pair_hbonds;  // H-bonds grouped by residue pair
     std::vector<core::HBond> all_hbonds;              // Flat list of all H-bonds
-    size_t total_residue_pairs_checked = 0;
+    size_t total_residue_pairs_checked = 0;           // Pairs with polar atoms in range that were classified
     size_t pairs_with_hbonds = 0;
 };
 
+/**
+ * @brief Dense per-atom slots for the two atoms of each H-bond in a list
+ *
+ * Atoms are keyed by (residue index, atom index), so global filters can keep
+ * per-atom counters in flat arrays instead of maps keyed by name strings.
+ */
+class HBondAtomSlots {
+public:
+    explicit HBondAtomSlots(const std::vector<core::HBond>& bonds);
+
+    /**
+     * @brief Slot of bonds[bond]'s first (donor) atom
+     */
+    [[nodiscard]] size_t donor(size_t bond) const {
+        return slots_[2 * bond];
+    }
+
+    /**
+     * @brief Slot of bonds[bond]'s second (acceptor) atom
+     */
+    [[nodiscard]] size_t acceptor(size_t bond) const {
+        return slots_[2 * bond + 1];
+    }
+
+    /**
+     * @brief Number of distinct atoms (slots are in [0, size()))
+     */
+    [[nodiscard]] size_t size() const {
+        return num_atoms_;
+    }
+
+private:
+    std::vector<size_t> slots_;
+    size_t num_atoms_ = 0;
+};
+
+/**
+ * @brief Rebuild result.residue_pair_hbonds from result.all_hbonds after a global filter
+ * @param result Result whose flat list was filtered; its current groups supply the residue IDs
+ * @param symmetric_pairs If true, (i, j) and (j, i) share a group listed under the smaller res_id first
+ *
+ * Groups are ordered by (res_id_i, res_id_j) and residues with the same res_id share
+ * a group, as when grouping by ID strings; bonds keep their flat-list order. Residue
+ * IDs are compared once per residue, not per bond.
+ */
+void regroup_residue_pair_hbonds(StructureHBondResult& result, bool symmetric_pairs);
+
 /**
  * @brief General-purpose H-bond detector with configurable parameters
  *
@@ -119,6 +189,45 @@ public:
         core::typing::MoleculeType mol1_type = core::typing::MoleculeType::NUCLEIC_ACID,
         core::typing::MoleculeType mol2_type = core::typing::MoleculeType::NUCLEIC_ACID) const;
 
+    /**
+     * @brief Detect all H-bonds using precomputed atom indices
+     * @param residue1 First residue
+     * @param index1 index_atoms(residue1)
+     * @param residue2 Second residue
+     * @param index2 index_atoms(residue2)
+     * @param mol1_type Molecule type for residue1
+     * @param mol2_type Molecule type for residue2
+     * @return Same result as detect_all_hbonds_detailed(residue1, residue2, ...)
+     */
+    [[nodiscard]] HBondPipelineResult detect_all_hbonds_detailed(const core::Residue& residue1,
+                                                                 const HBondAtomIndex& index1,
+                                                                 const core::Residue& residue2,
+                                                                 const HBondAtomIndex& index2,
+                                                                 core::typing::MoleculeType mol1_type,
+                                                                 core::typing::MoleculeType mol2_type) const;
+
+    /**
+     * @brief Detect and classify all H-bonds, skipping per-bond geometry
+     *
+     * Same bonds, classifications and counts as detect_all_hbonds_detailed with
+     * the same indices, but Leontis-Westhof edges and donor/acceptor angles are
+     * left unset. They are still computed when angle filtering or quality
+     * scoring needs them. Meant for callers that only count bonds.
+     */
+    [[nodiscard]] HBondPipelineResult classify_all_hbonds(const core::Residue& residue1, const HBondAtomIndex& index1,
+                                                          const core::Residue& residue2, const HBondAtomIndex& index2,
+                                                          core::typing::MoleculeType mol1_type,
+                                                          core::typing::MoleculeType mol2_type) const;
+
+    /**
+     * @brief Index the atoms of a residue that can take part in an H-bond
+     * @param residue Residue to index
+     * @return Atoms with an allowed element, with their classification flags
+     *
+     * Lets repeated pair scans skip non-polar atoms and per-pair name lookups.
+     */
+    [[nodiscard]] HBondAtomIndex index_atoms(const core::Residue& residue) const;
+
     // === Structure-Wide H-Bond Detection ===
 
     /**
@@ -128,7 +237,16 @@ public:
      * @return All H-bonds found, grouped by residue pair
      *
      * This detects ALL H-bonds between any atoms, not just base-pair H-bonds.
-     * Uses spatial filtering based on residue center distances for efficiency.
+     * Candidate atom pairs come from a cell list over the polar (allowed-element)
+     * atoms of the whole structure, within the largest context distance, and are
+     * grouped by residue pair before classification. Pairs whose residue centers
+     * are farther apart than max_residue_distance are skipped.
+     *
+     * With num_threads() > 1, the candidate search and the residue pairs run on a
+     * thread pool. Blocks of pairs fill their own buffers, which are merged in
+     * (i, j) order, so the result is the same for any thread count. Global
+     * filters (apply_global_occupancy_filter, DSSRStyleFilter) run on the merged
+     * result afterwards.
      */
     [[nodiscard]] StructureHBondResult detect_all_structure_hbonds(
         const core::Structure& structure,
@@ -163,6 +281,15 @@ public:
     void count_potential_hbonds(const core::Residue& residue1, const core::Residue& residue2, int& base_hbond_count,
                                 int& o2_prime_hbond_count) const;
 
+    /**
+     * @brief Count potential H-bonds using precomputed atom indices
+     *
+     * Same counts as count_potential_hbonds(residue1, residue2, ...).
+     */
+    void count_potential_hbonds(const core::Residue& residue1, const HBondAtomIndex& index1,
+                                const core::Residue& residue2, const HBondAtomIndex& index2,
+                                int& base_hbond_count, int& o2_prime_hbond_count) const;
+
     // === Intra-Residue H-Bond Detection ===
 
     /**
@@ -182,29 +309,75 @@ public:
         return params_;
     }
 
+    /**
+     * @brief Set the number of threads used by detect_all_structure_hbonds
+     * @param num_threads Thread count (1 = serial, 0 = hardware concurrency)
+     *
+     * Results are identical for any thread count.
+     */
+    void set_num_threads(int num_threads) {
+        num_threads_ = num_threads;
+    }
+
+    /**
+     * @brief Get the configured thread count
+     */
+    [[nodiscard]] int num_threads() const {
+        return num_threads_;
+    }
+
 private:
     HBondDetectionParams params_;
+    std::vector<int> allowed_element_indices_; // Parsed params_.allowed_elements
+    double max_context_distance_ = 0.0;        // Largest max_for_context over all contexts
+    int num_threads_ = 1;
+
+    // Polar atoms queried against the cell list per parallel task
+    static constexpr size_t POLAR_ATOMS_PER_TASK = 1024;
+
+    // Residue pairs run through the pipeline per parallel task
+    static constexpr size_t RESIDUE_PAIRS_PER_TASK = 64;
 
     // === Pipeline Implementation ===
 
     /**
      * @brief Internal detection with explicit options
      */
-    [[nodiscard]] HBondPipelineResult detect_internal(const core::Residue& residue1, const core::Residue& residue2,
+    [[nodiscard]] HBondPipelineResult detect_internal(const core::Residue& residue1, const HBondAtomIndex& index1,
+                                                       const core::Residue& residue2, const HBondAtomIndex& index2,
                                                        bool base_atoms_only, core::typing::MoleculeType mol1_type,
-                                                       core::typing::MoleculeType mol2_type) const;
+                                                       core::typing::MoleculeType mol2_type, bool with_geometry) const;
+
+    /**
+     * @brief Pipeline after the candidate search: resolve conflicts -> classify -> filter
+     * @param candidates Candidate bonds in find_candidate_bonds order. Steps read the atoms at
+     *        donor/acceptor_atom_idx, which must name the same atoms as donor/acceptor_atom_name;
+     *        indices outside the residues fall back to the name-based lookups.
+     * @param references1 Angle reference table of residue1 (nullptr: references are looked up by name)
+     * @param references2 Angle reference table of residue2 (nullptr: references are looked up by name)
+     */
+    [[nodiscard]] HBondPipelineResult process_candidates(std::vector<core::HBond> candidates,
+                                                         const core::Residue& residue1, const core::Residue& residue2,
+                                                         core::typing::MoleculeType mol1_type,
+                                                         core::typing::MoleculeType mol2_type, bool with_geometry,
+                                                         const AngleReferenceTable* references1 = nullptr,
+                                                         const AngleReferenceTable* references2 = nullptr) const;
 
     /**
      * @brief Find candidate H-bonds based on distance and element criteria
      * @param residue1 First residue
+     * @param index1 Polar atoms of residue1
      * @param residue2 Second residue
+     * @param index2 Polar atoms of residue2
      * @param base_atoms_only If true, only check base atoms
      * @param mol1_type Molecule type for residue1
      * @param mol2_type Molecule type for residue2
      * @return Vector of candidate H-bonds
      */
     [[nodiscard]] std::vector<core::HBond> find_candidate_bonds(const core::Residue& residue1,
-                                                                const core::Residue& residue2, bool base_atoms_only,
+                                                                const HBondAtomIndex& index1,
+                                                                const core::Residue& residue2,
+                                                                const HBondAtomIndex& index2, bool base_atoms_only,
                                                                 core::typing::MoleculeType mol1_type,
                                                                 core::typing::MoleculeType mol2_type) const;
 
@@ -221,20 +394,27 @@ private:
 
     /**
      * @brief Classify H-bonds based on donor/acceptor roles
-     * @param bonds H-bonds to classify (modified in place)
+     * @param bonds H-bonds to classify (modified in place); atoms are taken from donor/acceptor_atom_idx,
+     *        or by name when an index is outside its residue
+     * @param residue1 First residue (donor side)
      * @param base1_type One-letter code for residue1
+     * @param residue2 Second residue (acceptor side)
      * @param base2_type One-letter code for residue2
      */
-    void classify_bonds(std::vector<core::HBond>& bonds, char base1_type, char base2_type) const;
+    void classify_bonds(std::vector<core::HBond>& bonds, const core::Residue& residue1, char base1_type,
+                        const core::Residue& residue2, char base2_type) const;
 
     /**
      * @brief Calculate angles for all H-bonds
-     * @param bonds H-bonds to process (modified in place)
-     * @param residue1 First residue
-     * @param residue2 Second residue
+     * @param bonds H-bonds to process (modified in place); atoms are taken from donor/acceptor_atom_idx
+     * @param residue1 First residue (donor side)
+     * @param references1 Angle reference table of residue1, or nullptr to look up each bond's reference by name
+     * @param residue2 Second residue (acceptor side)
+     * @param references2 Angle reference table of residue2, or nullptr to look up each bond's reference by name
      */
     void calculate_angles(std::vector<core::HBond>& bonds, const core::Residue& residue1,
-                          const core::Residue& residue2) const;
+                          const AngleReferenceTable* references1, const core::Residue& residue2,
+                          const AngleReferenceTable* references2) const;
 
     /**
      * @brief Apply post-validation filtering (marks bonds as INVALID but doesn't remove them)
@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <x3dna/algorithms/hydrogen_bond/hbond_types.hpp>
+#include <x3dna/core/atom.hpp>
 
 namespace x3dna {
 namespace algorithms {
@@ -51,6 +52,14 @@ public:
      */
     [[nodiscard]] static core::BaseEdge classify(const std::string& atom_name, char base_type);
 
+    /**
+     * @brief Classify which edge an atom is on from the AtomType tables
+     * @param atom Atom; falls back to the name lookup when the tables do not cover it
+     * @param base_type One-letter base code ('A', 'C', 'G', 'U', 'T')
+     * @return Same edge as classify(atom.name(), base_type)
+     */
+    [[nodiscard]] static core::BaseEdge classify(const core::Atom& atom, char base_type);
+
     /**
      * @brief Classify edge from residue name (handles modified bases)
      * @param atom_name Atom name (trimmed)
@@ -20,27 +20,31 @@ namespace core {
  * based on detection order. The actual donor/acceptor roles are determined
  * during classification and reflected in the 'classification' field.
  * These names are kept for JSON compatibility with legacy output.
+ *
+ * Atoms are identified by (residue index, atom index); residue IDs are not
+ * stored per bond and are resolved from the residue index when writing output
+ * (ResidueHBonds carries them for structure-wide results). The neighbor atoms
+ * used for the angles follow from the atom names via
+ * HBondGeometry::get_neighbor_atom_name.
  */
 class HBond {
 public:
     // === Atom identification ===
     std::string donor_atom_name;    // First atom (provisional name)
     std::string acceptor_atom_name; // Second atom (provisional name)
+    size_t donor_atom_idx = 0;      // Index of the first atom in its residue's atoms()
+    size_t acceptor_atom_idx = 0;   // Index of the second atom in its residue's atoms()
 
     // === Residue information ===
     size_t donor_residue_idx = 0;
     size_t acceptor_residue_idx = 0;
-    std::string donor_res_id;    // e.g., "A-G-1"
-    std::string acceptor_res_id; // e.g., "A-C-12"
 
     // === Core geometry ===
     double distance = 0.0;
 
     // === Angles (heavy atoms only) ===
-    double donor_angle = 0.0; // X-D...A angle
-    std::string donor_neighbor_atom;
+    double donor_angle = 0.0;    // X-D...A angle
     double acceptor_angle = 0.0; // D...A-Y angle
-    std::string acceptor_neighbor_atom;
     double dihedral_angle = 0.0;
     bool dihedral_valid = false;
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <x3dna/core/atom_symbol_registry.hpp>
 
 namespace x3dna {
@@ -52,6 +53,20 @@ public:
  */
 [[nodiscard]] bool is_base_atom(const std::string& atom_name);
 
+/**
+ * @brief Check if atom is in the legacy good_hbatoms PO list (phosphate, O3'/O4'/O5', N7)
+ * @param atom_name Atom name
+ * @return True if two such atoms may not form an H-bond with each other
+ */
+[[nodiscard]] bool is_po_list_atom(const std::string& atom_name);
+
+/**
+ * @brief Parse an H-bond atom list into legacy element indices (matches legacy hb_idx)
+ * @param hb_atoms H-bond atom list (e.g. ".O.N" gives {2, 4})
+ * @return Element indices in list order
+ */
+[[nodiscard]] std::vector<int> parse_hb_atom_indices(const std::string& hb_atoms);
+
 /**
  * @brief Check if two atoms can form a hydrogen bond (matches legacy good_hbatoms)
  * @param atom1 First atom name
@@ -9,6 +9,7 @@
 #include <vector>
 #include <x3dna/algorithms/hydrogen_bond/hbond_types.hpp>
 #include <x3dna/algorithms/hydrogen_bond/hbond.hpp>
+#include <x3dna/core/atom.hpp>
 #include <x3dna/core/typing/molecule_type.hpp>
 
 namespace x3dna {
@@ -34,6 +35,14 @@ public:
      */
     [[nodiscard]] static core::HBondAtomRole get_nucleotide_atom_role(char base, const std::string& atom_name);
 
+    /**
+     * @brief Get atom role for a nucleotide base from the AtomType tables
+     * @param base One-letter code (A, C, G, T, U, I)
+     * @param atom Atom; falls back to the name lookup when the tables do not cover it
+     * @return Same role as get_nucleotide_atom_role(base, atom.name())
+     */
+    [[nodiscard]] static core::HBondAtomRole get_nucleotide_atom_role(char base, const core::Atom& atom);
+
     /**
      * @brief Classify bond for nucleotide-nucleotide interaction
      * @param base1 First base one-letter code
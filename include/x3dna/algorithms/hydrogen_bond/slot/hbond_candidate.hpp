@@ -26,6 +26,10 @@ struct HBondCandidate {
     std::string donor_atom;
     std::string acceptor_atom;
 
+    // Atom indices in the donor and acceptor residues' atoms()
+    size_t donor_atom_idx = 0;
+    size_t acceptor_atom_idx = 0;
+
     // Positions
     geometry::Vector3D donor_pos;
     geometry::Vector3D acceptor_pos;
@@ -5,11 +5,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <vector>
 #include <x3dna/algorithms/hydrogen_bond/slot/slot.hpp>
 #include <x3dna/algorithms/hydrogen_bond/slot/slot_predictor.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_store.hpp>
 #include <x3dna/core/residue.hpp>
 
 namespace x3dna {
@@ -21,12 +22,20 @@ namespace slot {
  * @class SlotCache
  * @brief Caches computed H and LP slots for a residue
  *
- * Slots are computed lazily on first access and cached for reuse.
+ * Slots are computed lazily on first access and cached for reuse, indexed by
+ * atom index. When bound to a SlotStore they are copied from the store instead
+ * of being predicted. rebind() switches to another residue and keeps the
+ * buffers, so one cache can be reused for every pair in a run.
  * The cache should be cleared between optimization runs to reset
  * slot usage tracking.
  */
 class SlotCache {
 public:
+    /**
+     * @brief Construct an unbound cache; call rebind() before use
+     */
+    SlotCache() = default;
+
     /**
      * @brief Construct cache for a residue
      * @param residue Reference to the residue (must outlive cache)
@@ -34,6 +43,23 @@ public:
      */
     SlotCache(const core::Residue& residue, char base_type);
 
+    /**
+     * @brief Construct cache for a residue of a slot store
+     * @param store Store with the residue's slots (must outlive cache)
+     * @param residue_idx Residue index in the store
+     */
+    SlotCache(const SlotStore& store, size_t residue_idx);
+
+    /**
+     * @brief Switch to another residue, dropping cached slots but keeping buffers
+     */
+    void rebind(const core::Residue& residue, char base_type);
+
+    /**
+     * @brief Switch to a residue of a slot store, dropping cached slots but keeping buffers
+     */
+    void rebind(const SlotStore& store, size_t residue_idx);
+
     /**
      * @brief Get H slots for a donor atom (computes if not cached)
      * @param atom_name Donor atom name
@@ -48,6 +74,16 @@ public:
      */
     [[nodiscard]] std::vector<LPSlot>& get_lp_slots(const std::string& atom_name);
 
+    /**
+     * @brief Get H slots for a donor atom by index in residue().atoms()
+     */
+    [[nodiscard]] std::vector<HSlot>& get_h_slots(size_t atom_idx);
+
+    /**
+     * @brief Get LP slots for an acceptor atom by index in residue().atoms()
+     */
+    [[nodiscard]] std::vector<LPSlot>& get_lp_slots(size_t atom_idx);
+
     /**
      * @brief Reset all slots to unused state (clears bond_directions)
      */
@@ -62,18 +98,31 @@ public:
     [[nodiscard]] char base_type() const { return base_type_; }
 
     /** @brief Get the residue reference */
-    [[nodiscard]] const core::Residue& residue() const { return residue_; }
+    [[nodiscard]] const core::Residue& residue() const { return *residue_; }
 
 private:
-    const core::Residue& residue_;
-    char base_type_;
+    static constexpr uint8_t H_CACHED = 1;
+    static constexpr uint8_t LP_CACHED = 2;
+
+    const core::Residue* residue_ = nullptr;
+    char base_type_ = '?';
+    const SlotStore* store_ = nullptr;
+    size_t residue_idx_ = 0;
     geometry::Vector3D base_normal_;
     bool normal_computed_ = false;
 
-    std::unordered_map<std::string, std::vector<HSlot>> h_slots_;
-    std::unordered_map<std::string, std::vector<LPSlot>> lp_slots_;
+    // Indexed by atom index; cached_ holds H_CACHED/LP_CACHED flags
+    std::vector<std::vector<HSlot>> h_slots_;
+    std::vector<std::vector<LPSlot>> lp_slots_;
+    std::vector<uint8_t> cached_;
+
+    // Returned for names with no atom in the residue
+    std::vector<HSlot> no_h_slots_;
+    std::vector<LPSlot> no_lp_slots_;
 
     void ensure_base_normal();
+    void resize_for_residue();
+    [[nodiscard]] size_t find_atom_index(const std::string& atom_name) const;
 };
 
 } // namespace slot
@@ -53,6 +53,18 @@ public:
         const core::Residue& res1,
         const core::Residue& res2);
 
+    /**
+     * @brief Optimize H-bonds between two residues of a slot store
+     * @param store Slots predicted once for the structure
+     * @param residue_idx1 First residue index in the store
+     * @param residue_idx2 Second residue index in the store
+     * @return Vector of selected H-bonds (same as optimize_pair on the residues)
+     */
+    [[nodiscard]] std::vector<core::HBond> optimize_pair(
+        const SlotStore& store,
+        size_t residue_idx1,
+        size_t residue_idx2);
+
     /**
      * @brief Get current parameters
      */
@@ -63,9 +75,18 @@ public:
      */
     void set_params(const SlotOptimizerParams& params) { params_ = params; }
 
+    /**
+     * @brief Get base type character for a residue
+     */
+    [[nodiscard]] static char get_base_type(const core::Residue& residue);
+
 private:
     SlotOptimizerParams params_;
 
+    // Reused for every pair so their slot buffers are allocated once
+    SlotCache cache1_;
+    SlotCache cache2_;
+
     /**
      * @brief Find all candidate H-bonds between two residues
      */
@@ -114,11 +135,6 @@ private:
      */
     [[nodiscard]] core::HBond candidate_to_hbond(const HBondCandidate& candidate) const;
 
-    /**
-     * @brief Get base type character for a residue
-     */
-    [[nodiscard]] static char get_base_type(const core::Residue& residue);
-
     /**
      * @brief Check if both atoms are backbone atoms
      */
@@ -0,0 +1,107 @@
+/**
+ * @file slot_store.hpp
+ * @brief Per-structure store of predicted H and LP slot directions
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot.hpp>
+#include <x3dna/core/residue.hpp>
+#include <x3dna/geometry/matrix3d.hpp>
+#include <x3dna/geometry/vector3d.hpp>
+
+namespace x3dna {
+namespace algorithms {
+namespace hydrogen_bond {
+namespace slot {
+
+/**
+ * @class SlotStore
+ * @brief H and LP slot directions of every residue in a structure, predicted once
+ *
+ * assign() runs SlotPredictor once per donor/acceptor atom. It stores the
+ * slot directions in the residue's base reference frame, or in structure
+ * coordinates when the residue has no frame. h_slots() and lp_slots() rotate
+ * them back by the frame on access. Slots are indexed by (residue index, atom
+ * index) in the order given to assign().
+ *
+ * Buffers are kept between assign() calls so batch runs reuse them.
+ * clear() releases them once they grow past RETAINED_SLOT_LIMIT, which bounds
+ * the memory one store keeps between structures.
+ */
+class SlotStore {
+public:
+    /// Slot directions kept allocated by clear(); larger buffers are released
+    static constexpr size_t RETAINED_SLOT_LIMIT = size_t{1} << 16;
+
+    SlotStore() = default;
+
+    /**
+     * @brief Predict the slots of a structure's residues, replacing the previous contents
+     * @param residues Residues in index order (must outlive the store's use)
+     */
+    void assign(const std::vector<const core::Residue*>& residues);
+
+    /**
+     * @brief Drop all residues; keeps buffers up to RETAINED_SLOT_LIMIT for reuse
+     */
+    void clear();
+
+    /** @brief Number of residues */
+    [[nodiscard]] size_t num_residues() const { return residues_.size(); }
+
+    /** @brief Residue at an index */
+    [[nodiscard]] const core::Residue& residue(size_t residue_idx) const { return *residues_[residue_idx].residue; }
+
+    /** @brief Base type used for slot prediction (SlotOptimizer::get_base_type) */
+    [[nodiscard]] char base_type(size_t residue_idx) const { return residues_[residue_idx].base_type; }
+
+    /**
+     * @brief H slots of a donor atom in structure coordinates, all unused
+     * @param out Replaced with the slots (empty if the atom donates none)
+     */
+    void h_slots(size_t residue_idx, size_t atom_idx, std::vector<HSlot>& out) const;
+
+    /**
+     * @brief LP slots of an acceptor atom in structure coordinates, all unused
+     * @param out Replaced with the slots (empty if the atom accepts none)
+     */
+    void lp_slots(size_t residue_idx, size_t atom_idx, std::vector<LPSlot>& out) const;
+
+private:
+    struct SlotDirection {
+        geometry::Vector3D local; // Direction in the residue's base frame
+        int max_bonds;
+    };
+
+    struct AtomSlots {
+        uint32_t h_begin = 0;
+        uint32_t lp_begin = 0;
+        uint8_t h_count = 0;
+        uint8_t lp_count = 0;
+    };
+
+    struct ResidueSlots {
+        const core::Residue* residue;
+        char base_type;
+        geometry::Matrix3D rotation; // Base frame to structure coordinates
+        size_t atom_begin;           // First entry in atoms_
+    };
+
+    std::vector<ResidueSlots> residues_;
+    std::vector<AtomSlots> atoms_;
+    std::vector<SlotDirection> h_directions_;
+    std::vector<SlotDirection> lp_directions_;
+
+    [[nodiscard]] const AtomSlots& atom_slots(size_t residue_idx, size_t atom_idx) const {
+        return atoms_[residues_[residue_idx].atom_begin + atom_idx];
+    }
+};
+
+} // namespace slot
+} // namespace hydrogen_bond
+} // namespace algorithms
+} // namespace x3dna
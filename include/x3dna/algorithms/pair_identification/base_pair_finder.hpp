@@ -11,6 +11,7 @@
 #include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
 #include <x3dna/algorithms/pair_identification/quality_score_calculator.hpp>
 #include <x3dna/algorithms/pair_identification/pair_candidate_cache.hpp>
+#include <x3dna/algorithms/pair_identification/nucleotide_eligibility.hpp>
 #include <x3dna/algorithms/pair_identification/pair_finding_observer.hpp>
 #include <x3dna/algorithms/pair_identification/pair_selection_strategy.hpp>
 #include <x3dna/io/json_writer.hpp>
@@ -97,6 +98,23 @@ public:
         return validator_.parameters();
     }
 
+    /**
+     * @brief Set the number of threads used for nucleotide classification and Phase 1 pair validation
+     * @param num_threads Thread count (1 = serial, 0 = hardware concurrency)
+     *
+     * Results are identical for any thread count.
+     */
+    void set_num_threads(int num_threads) {
+        num_threads_ = num_threads;
+    }
+
+    /**
+     * @brief Get the configured Phase 1 thread count
+     */
+    [[nodiscard]] int num_threads() const {
+        return num_threads_;
+    }
+
     /**
      * @brief Check if residue is a nucleotide
      * @param residue Residue to check
@@ -110,6 +128,13 @@ private:
     QualityScoreCalculator quality_calculator_;
     PairFindingStrategy strategy_;
     mutable PairCandidateCache cache_;
+    int num_threads_ = 1;
+
+    // Below this many pairable residues Phase 1 scans all pairs instead of building a cell list
+    static constexpr size_t SPATIAL_GRID_MIN_RESIDUES = 64;
+
+    // Rows (residues) validated per parallel Phase 1 task
+    static constexpr size_t PHASE1_ROWS_PER_TASK = 8;
 
     // ============================================================================
     // Internal types - must be defined before methods that use them
@@ -117,33 +142,39 @@ private:
 
     /** @brief Results from Phase 1 validation of all pairs */
     struct Phase1Results {
-        std::map<std::pair<int, int>, ValidationResult> validation_results;
-        std::map<std::pair<int, int>, int> bp_type_ids;
+        CandidateTable candidates; // Per-residue candidate rows; entry score is the selection score
+        HBondDetail hbond_detail = HBondDetail::LIST; // SUMMARY: stored results have no H-bond lists
 
         [[nodiscard]] const ValidationResult* get_result(int idx1, int idx2) const {
-            auto key = (idx1 < idx2) ? std::make_pair(idx1, idx2) : std::make_pair(idx2, idx1);
-            auto it = validation_results.find(key);
-            return (it != validation_results.end()) ? &it->second : nullptr;
+            const CandidateInfo* info = candidates.find(idx1, idx2);
+            return info ? &info->validation : nullptr;
         }
 
         [[nodiscard]] int get_bp_type_id(int idx1, int idx2) const {
-            auto key = (idx1 < idx2) ? std::make_pair(idx1, idx2) : std::make_pair(idx2, idx1);
-            auto it = bp_type_ids.find(key);
-            return (it != bp_type_ids.end()) ? it->second : 0;
+            const CandidateEntry* entry = candidates.find_entry(idx1, idx2);
+            return entry ? entry->bp_type_id : 0;
         }
     };
 
-    /** @brief Mapping between legacy indices and residue pointers */
+    /** @brief Mapping between legacy indices and residue pointers (dense, indexed by legacy index) */
     struct ResidueIndexMapping {
-        std::map<int, const core::Residue*> by_legacy_idx;
+        std::vector<const core::Residue*> by_legacy_idx; // Slot 0 unused; nullptr for gaps
+        std::vector<bool> pairable;                      // Nucleotide with a reference frame
         int max_legacy_idx = 0;
+        size_t num_residues = 0;
 
         [[nodiscard]] const core::Residue* get(int legacy_idx) const {
-            auto it = by_legacy_idx.find(legacy_idx);
-            return (it != by_legacy_idx.end()) ? it->second : nullptr;
+            if (legacy_idx < 0 || legacy_idx >= static_cast<int>(by_legacy_idx.size())) {
+                return nullptr;
+            }
+            return by_legacy_idx[legacy_idx];
         }
 
-        [[nodiscard]] bool empty() const { return by_legacy_idx.empty(); }
+        [[nodiscard]] bool is_pairable(int legacy_idx) const {
+            return legacy_idx > 0 && legacy_idx < static_cast<int>(pairable.size()) && pairable[legacy_idx];
+        }
+
+        [[nodiscard]] bool empty() const { return num_residues == 0; }
     };
 
     /** @brief Context for partner search - groups related data to reduce parameters */
@@ -181,10 +212,20 @@ private:
     [[nodiscard]] std::vector<core::BasePair> find_best_pairs(core::Structure& structure,
                                                               io::JsonWriter* writer = nullptr) const;
     [[nodiscard]] std::vector<core::BasePair> find_all_pairs(const core::Structure& structure) const;
-    [[nodiscard]] std::optional<std::pair<int, ValidationResult>> find_best_partner(
-        int legacy_idx, const PartnerSearchContext& ctx) const;
 
-    [[nodiscard]] double adjust_pair_quality(const std::vector<core::hydrogen_bond>& hbonds) const;
+    /**
+     * @brief Legacy pass-by-pass mutual-best loop that records every step to the writer
+     * @return Number of passes run
+     */
+    int run_recorded_selection(const ResidueIndexMapping& mapping, const PartnerSearchContext& ctx,
+                               PairSelectionState& state, io::JsonWriter* writer) const;
+    /**
+     * @brief Best unmatched valid partner of a residue
+     * @return Entry in ctx.phase1.candidates (nullptr if none); valid until Phase 1 results are destroyed
+     */
+    [[nodiscard]] const CandidateEntry* find_best_partner(int legacy_idx, const PartnerSearchContext& ctx) const;
+
+    [[nodiscard]] double adjust_pair_quality(int num_good_hb) const;
     [[nodiscard]] int calculate_bp_type_id(const core::Residue* res1, const core::Residue* res2,
                                            const ValidationResult& result, double quality_score) const;
     [[nodiscard]] double calculate_adjusted_score(const ValidationResult& result, int bp_type_id) const;
@@ -194,18 +235,21 @@ private:
                                    io::JsonWriter* writer) const;
 
     [[nodiscard]] static size_t get_residue_index(const core::Structure& structure, const core::Residue& residue);
-    [[nodiscard]] static bool can_participate_in_pairing(const core::Residue* res);
     [[nodiscard]] static bool is_matched(int legacy_idx, const std::vector<bool>& matched);
 
-    [[nodiscard]] ResidueIndexMapping build_residue_index_mapping(const core::Structure& structure) const;
-    [[nodiscard]] Phase1Results run_phase1_validation(const ResidueIndexMapping& mapping) const;
+    [[nodiscard]] ResidueIndexMapping build_residue_index_mapping(const core::Structure& structure,
+                                                                  const NucleotideEligibility& eligibility) const;
+    [[nodiscard]] Phase1Results run_phase1_validation(const ResidueIndexMapping& mapping, ValidationMode mode,
+                                                      HBondDetail hbond_detail) const;
+    /**
+     * @brief Build the BasePair for a validated pair
+     * @param hbond_detail Detail result was validated with; for SUMMARY the H-bond list is detected here
+     */
     [[nodiscard]] core::BasePair create_base_pair(int legacy_idx1, int legacy_idx2, const core::Residue* res1,
-                                                  const core::Residue* res2, const ValidationResult& result) const;
-    [[nodiscard]] bool try_select_mutual_pair(int legacy_idx1, int legacy_idx2,
-                                               const core::Residue* res1, const core::Residue* res2,
-                                               const ValidationResult& result,
-                                               const PartnerSearchContext& ctx,
-                                               PairSelectionState& state) const;
+                                                  const core::Residue* res2, const ValidationResult& result,
+                                                  HBondDetail hbond_detail) const;
+    [[nodiscard]] bool try_select_mutual_pair(int legacy_idx1, int legacy_idx2, const PartnerSearchContext& ctx,
+                                              PairSelectionState& state) const;
 };
 
 } // namespace algorithms
@@ -12,6 +12,8 @@
 #include <x3dna/geometry/matrix3d.hpp>
 #include <x3dna/algorithms/validation_constants.hpp>
 #include <x3dna/algorithms/validation/ring_data_cache.hpp>
+#include <x3dna/algorithms/validation/hbond_atom_cache.hpp>
+#include <x3dna/algorithms/hydrogen_bond/detector.hpp>
 #include <x3dna/algorithms/hydrogen_bond/types.hpp>
 #include <vector>
 #include <optional>
@@ -84,7 +86,8 @@ struct ValidationResult {
     double overlap_area = 0.0;
 
     // Hydrogen bonds
-    std::vector<core::hydrogen_bond> hbonds;
+    std::vector<core::hydrogen_bond> hbonds; // Empty for results validated with HBondDetail::SUMMARY
+    int num_good_hb = 0;                     // Bonds counted by adjust_pair_quality (set for valid pairs)
     int num_base_hb = 0;
     int num_o2_hb = 0;
 
@@ -97,12 +100,58 @@ struct ValidationResult {
     bool hbond_check = false;
 };
 
+/**
+ * @brief How much of the check pipeline BasePairValidator::validate runs
+ */
+enum class ValidationMode {
+    FULL,         // Run every check and fill every field (JSON recording needs this)
+    SHORT_CIRCUIT // Run checks cheapest first and return at the first failure
+};
+
+/**
+ * @brief How much H-bond detail BasePairValidator::validate produces for a valid pair
+ */
+enum class HBondDetail {
+    LIST,   // Fill hbonds with the detected H-bonds (and num_good_hb)
+    SUMMARY // Only num_good_hb; skips H-bond edges, angles and the list itself
+};
+
+/**
+ * @brief A residue together with its precomputed ring and H-bond atom data
+ */
+struct PreparedResidue {
+    const core::Residue& residue;
+    const validation::ResidueRingData& ring;
+    const hydrogen_bond::HBondAtomIndex& hbond_atoms;
+};
+
+/**
+ * @brief Ring and H-bond atom data for a list of residues (see BasePairValidator::prepare)
+ *
+ * Entry i belongs to residues[i]. Read-only once built, so it can be shared by
+ * threads validating different pairs.
+ */
+struct PreparedResidues {
+    std::vector<const core::Residue*> residues;
+    validation::RingDataCache rings;
+    validation::HBondAtomCache hbond_atoms;
+
+    [[nodiscard]] PreparedResidue operator[](size_t index) const {
+        return {*residues[index], rings[index], hbond_atoms[index]};
+    }
+
+    [[nodiscard]] size_t size() const { return residues.size(); }
+};
+
 /**
  * @class BasePairValidator
  * @brief Validates base pairs using legacy check_pair algorithm
  *
  * This class implements the exact validation logic from the legacy check_pair function,
  * including distance checks, angle checks, overlap detection, and hydrogen bond validation.
+ *
+ * The validator holds no per-structure state; one instance can validate from several
+ * threads at once.
  */
 class BasePairValidator {
 public:
@@ -110,15 +159,50 @@ public:
      * @brief Constructor with default parameters
      */
     explicit BasePairValidator(const ValidationParameters& params = ValidationParameters::defaults())
-        : params_(params) {}
+        : params_(params), hbond_detector_(HBondDetectionParams::legacy_compatible()) {}
 
     /**
      * @brief Validate a potential base pair
      * @param res1 First residue
      * @param res2 Second residue
+     * @param mode FULL fills every field. SHORT_CIRCUIT checks frame geometry, dNN, the
+     *             H-bond count and then overlap, and returns at the first failure.
+     * @param hbond_detail SUMMARY leaves hbonds empty; find_hydrogen_bonds(res1, res2)
+     *                     returns the list that LIST would have stored
      * @return ValidationResult with all validation details
+     *
+     * is_valid, and every field of a valid result, is the same in both modes. A result
+     * rejected in SHORT_CIRCUIT mode leaves the fields of checks it did not reach at
+     * their defaults.
+     *
+     * Computes the ring and H-bond atom data of both residues; callers validating many
+     * pairs should prepare() the residues once and use the PreparedResidue overload.
+     */
+    [[nodiscard]] ValidationResult validate(const core::Residue& res1, const core::Residue& res2,
+                                            ValidationMode mode = ValidationMode::FULL,
+                                            HBondDetail hbond_detail = HBondDetail::LIST) const;
+
+    /**
+     * @brief Validate a potential base pair using precomputed residue data
+     *
+     * Same result as validate(res1.residue, res2.residue, mode, hbond_detail).
+     */
+    [[nodiscard]] ValidationResult validate(const PreparedResidue& res1, const PreparedResidue& res2,
+                                            ValidationMode mode = ValidationMode::FULL,
+                                            HBondDetail hbond_detail = HBondDetail::LIST) const;
+
+    /**
+     * @brief Compute the ring and H-bond atom data of each residue once
+     * @param residues Residues to prepare (must outlive the result)
      */
-    [[nodiscard]] ValidationResult validate(const core::Residue& res1, const core::Residue& res2) const;
+    [[nodiscard]] PreparedResidues prepare(std::vector<const core::Residue*> residues) const;
+
+    /**
+     * @brief Find hydrogen bonds between two residues (with validation)
+     * Used for adjust_pairQuality - matches hb_numlist behavior
+     */
+    [[nodiscard]] std::vector<core::hydrogen_bond> find_hydrogen_bonds(const core::Residue& res1,
+                                                                       const core::Residue& res2) const;
 
     /**
      * @brief Set validation parameters
@@ -157,9 +241,18 @@ public:
     [[nodiscard]] static char donor_acceptor(char base1, char base2, const std::string& atom1,
                                              const std::string& atom2);
 
+    /**
+     * @brief donor_acceptor from the AtomType role tables
+     *
+     * Falls back to the name lookup when the tables do not cover either atom;
+     * the result is the same as donor_acceptor(base1, base2, atom1.name(), atom2.name()).
+     */
+    [[nodiscard]] static char donor_acceptor(char base1, char base2, const core::Atom& atom1,
+                                             const core::Atom& atom2);
+
 private:
     ValidationParameters params_;
-    mutable validation::RingDataCache ring_data_cache_; // Cache for overlap calculation
+    hydrogen_bond::HBondDetector hbond_detector_; // Legacy-compatible H-bond counting and detection
 
     /**
      * @brief Pattern match function (matches legacy str_pmatch)
@@ -197,17 +290,25 @@ private:
     [[nodiscard]] static std::optional<geometry::Vector3D> find_n1_n9_position(const core::Residue& residue);
 
     /**
-     * @brief Find hydrogen bonds between two residues (with validation)
-     * Used for adjust_pairQuality - matches hb_numlist behavior
+     * @brief Number of bonds in find_hydrogen_bonds(res1, res2) that adjust_pairQuality counts
+     *
+     * Runs the H-bond pipeline without edge and angle calculation and builds no list.
      */
-    [[nodiscard]] std::vector<core::hydrogen_bond> find_hydrogen_bonds(const core::Residue& res1,
-                                                                       const core::Residue& res2) const;
+    [[nodiscard]] int count_good_hydrogen_bonds(const PreparedResidue& res1, const PreparedResidue& res2) const;
 
     /**
      * @brief Count hydrogen bonds simply (before validation) - matches legacy check_pair behavior
+     *
+     * Sets num_base_hb, num_o2_hb and hbond_check of the result.
+     */
+    void count_hydrogen_bonds_simple(const PreparedResidue& res1, const PreparedResidue& res2,
+                                     ValidationResult& result) const;
+
+    /**
+     * @brief H-bond list from precomputed atom indices (see find_hydrogen_bonds)
      */
-    void count_hydrogen_bonds_simple(const core::Residue& res1, const core::Residue& res2, int& num_base_hb,
-                                     int& num_o2_hb) const;
+    [[nodiscard]] std::vector<core::hydrogen_bond> find_hydrogen_bonds(const PreparedResidue& res1,
+                                                                       const PreparedResidue& res2) const;
 };
 
 } // namespace algorithms
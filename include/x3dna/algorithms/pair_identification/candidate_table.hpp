@@ -0,0 +1,171 @@
+/**
+ * @file candidate_table.hpp
+ * @brief Flat (CSR) storage of Phase 1 pair candidates
+ */
+
+#pragma once
+
+#include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace x3dna {
+namespace algorithms {
+
+/**
+ * @struct CandidateInfo
+ * @brief Information about a validated pair candidate
+ */
+struct CandidateInfo {
+    ValidationResult validation;
+    int bp_type_id;
+    double adjusted_quality_score;
+
+    [[nodiscard]] bool is_valid() const {
+        return validation.is_valid;
+    }
+};
+
+/**
+ * @struct CandidateEntry
+ * @brief One row entry of the candidate table (residue -> partner)
+ *
+ * Holds everything partner search needs without touching the result pool;
+ * the full CandidateInfo is reached through result_index.
+ */
+struct CandidateEntry {
+    int partner;         // Partner legacy index
+    int bp_type_id;      // 0 for invalid pairs
+    double score;        // Selection score (lower is better), max() for invalid pairs
+    size_t result_index; // Index into CandidateTable::pairs()
+    bool is_valid;
+};
+
+/**
+ * @class CandidateTable
+ * @brief Per-residue contiguous candidate lists over a shared result pool
+ *
+ * Pairs are appended once (smaller legacy index first) during Phase 1, then
+ * finalize() lays out a CSR index: row r holds one CandidateEntry per
+ * candidate partner of residue r, sorted by partner index. Lookups are a
+ * binary search within a row; iterating a row is a linear scan.
+ *
+ * Usage:
+ * @code
+ * CandidateTable table;
+ * table.reset(max_legacy_idx);
+ * table.add(1, 24, info, score);
+ * table.finalize();
+ *
+ * for (const auto& entry : table.row(1)) {
+ *     const CandidateInfo& info = table.info(entry);
+ * }
+ * @endcode
+ */
+class CandidateTable {
+public:
+    using PairKey = std::pair<int, int>;
+    using CandidatePair = std::pair<PairKey, CandidateInfo>;
+
+    /**
+     * @brief Contiguous view of one residue's candidates
+     */
+    class Row {
+    public:
+        Row(const CandidateEntry* first, const CandidateEntry* last) : first_(first), last_(last) {}
+
+        [[nodiscard]] const CandidateEntry* begin() const {
+            return first_;
+        }
+        [[nodiscard]] const CandidateEntry* end() const {
+            return last_;
+        }
+        [[nodiscard]] size_t size() const {
+            return static_cast<size_t>(last_ - first_);
+        }
+        [[nodiscard]] bool empty() const {
+            return first_ == last_;
+        }
+
+    private:
+        const CandidateEntry* first_;
+        const CandidateEntry* last_;
+    };
+
+    /**
+     * @brief Clear the table and size rows for legacy indices 1..max_legacy_idx
+     */
+    void reset(int max_legacy_idx);
+
+    /**
+     * @brief Append a candidate pair (before finalize)
+     * @param idx1 Smaller legacy index
+     * @param idx2 Larger legacy index
+     * @param info Validation result and bp_type_id
+     * @param score Selection score stored in both row entries
+     */
+    void add(int idx1, int idx2, CandidateInfo info, double score);
+
+    /**
+     * @brief Build the per-residue rows from appended pairs
+     */
+    void finalize();
+
+    /**
+     * @brief Candidates of a residue, sorted by partner index
+     */
+    [[nodiscard]] Row row(int legacy_idx) const;
+
+    /**
+     * @brief Find the entry for (legacy_idx, partner) in legacy_idx's row
+     * @return Entry pointer or nullptr if the pair is not a candidate
+     */
+    [[nodiscard]] const CandidateEntry* find_entry(int legacy_idx, int partner) const;
+
+    /**
+     * @brief Find candidate info for a pair (order-independent)
+     * @return Info pointer or nullptr if the pair is not a candidate
+     */
+    [[nodiscard]] const CandidateInfo* find(int legacy_idx1, int legacy_idx2) const {
+        const CandidateEntry* entry = find_entry(legacy_idx1, legacy_idx2);
+        return entry ? &info(*entry) : nullptr;
+    }
+
+    /**
+     * @brief Full info for a row entry
+     */
+    [[nodiscard]] const CandidateInfo& info(const CandidateEntry& entry) const {
+        return pairs_[entry.result_index].second;
+    }
+
+    /**
+     * @brief All pairs in insertion order (smaller index first)
+     */
+    [[nodiscard]] const std::vector<CandidatePair>& pairs() const {
+        return pairs_;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return pairs_.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return pairs_.empty();
+    }
+
+    [[nodiscard]] int max_legacy_idx() const {
+        return max_legacy_idx_;
+    }
+
+private:
+    int max_legacy_idx_ = 0;
+    std::vector<CandidatePair> pairs_;
+    std::vector<double> scores_;
+    std::vector<size_t> row_start_; // Size max_legacy_idx + 2; row r is [row_start_[r], row_start_[r + 1])
+    std::vector<CandidateEntry> entries_;
+};
+
+} // namespace algorithms
+} // namespace x3dna
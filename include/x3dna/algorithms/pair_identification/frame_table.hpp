@@ -0,0 +1,109 @@
+/**
+ * @file frame_table.hpp
+ * @brief Structure-of-arrays reference frames with a batch geometric prefilter
+ */
+
+#pragma once
+
+#include <x3dna/core/residue.hpp>
+#include <x3dna/geometry/vector3d.hpp>
+#include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace x3dna {
+namespace algorithms {
+
+/**
+ * @class FrameTable
+ * @brief Contiguous origins and axes of a set of residue frames
+ *
+ * Residue::reference_frame() returns a copy, and BasePairValidator::validate
+ * recomputes the frame geometry one pair at a time. This table copies each
+ * frame once into per-component arrays. It then screens one residue against
+ * a block of candidates in tight loops over those arrays. The screen covers
+ * origin distance, vertical distance, plane angle (as a cosine compare) and
+ * the axis dot products.
+ *
+ * The prefilter is conservative: a pair is REJECTED only when it fails a
+ * frame-only check by more than a small tolerance, so full validation of the
+ * pair could not have accepted it. Borderline pairs are left as CANDIDATE.
+ *
+ * Usage:
+ * @code
+ * FrameTable frames;
+ * frames.build(residues);  // all residues must have reference frames
+ * frames.prefilter(i, partners.data(), partners.size(), params, screened.data());
+ * @endcode
+ */
+class FrameTable {
+public:
+    /**
+     * @brief Outcome of the frame-only checks for one pair
+     */
+    enum class Screen : uint8_t {
+        OUT_OF_RANGE, // Origin distance above max_dorg (not a Phase 1 candidate at all)
+        REJECTED,     // Within max_dorg but certain to fail validation
+        CANDIDATE     // Needs full validation
+    };
+
+    /**
+     * @brief Frame-derived values for one pair (residue i first, as in validate(res_i, res_j))
+     */
+    struct PairGeometry {
+        double dorg = 0.0;
+        double d_v = 0.0;
+        double dir_x = 0.0;
+        double dir_y = 0.0;
+        double dir_z = 0.0;
+        Screen screen = Screen::OUT_OF_RANGE;
+    };
+
+    /**
+     * @brief Copy frames of the given residues (table index = position in the vector)
+     * @throws std::invalid_argument if a residue has no reference frame
+     */
+    void build(const std::vector<const core::Residue*>& residues);
+
+    [[nodiscard]] size_t size() const {
+        return ox_.size();
+    }
+
+    [[nodiscard]] geometry::Vector3D origin(size_t i) const {
+        return geometry::Vector3D(ox_[i], oy_[i], oz_[i]);
+    }
+
+    /**
+     * @brief Screen residue i against a block of other residues
+     * @param i Table index of the first residue
+     * @param others Table indices of the partners
+     * @param count Number of partners
+     * @param params Validation limits
+     * @param out Receives count results, in the order of others
+     */
+    void prefilter(size_t i, const size_t* others, size_t count, const ValidationParameters& params,
+                   PairGeometry* out) const;
+
+    /**
+     * @brief Fill the frame-derived fields and checks of a result for a REJECTED pair
+     *
+     * Only dorg, d_v, dir_x/y/z and the distance, d_v and plane-angle checks are
+     * set; is_valid is false.
+     */
+    [[nodiscard]] static ValidationResult rejected_result(const PairGeometry& geometry,
+                                                          const ValidationParameters& params);
+
+private:
+    // Origin, x-, y- and z-axis components, one entry per residue
+    std::vector<double> ox_, oy_, oz_;
+    std::vector<double> xx_, xy_, xz_;
+    std::vector<double> yx_, yy_, yz_;
+    std::vector<double> zx_, zy_, zz_;
+
+    // Partners gathered per kernel pass
+    static constexpr size_t BLOCK_SIZE = 64;
+};
+
+} // namespace algorithms
+} // namespace x3dna
@@ -0,0 +1,88 @@
+/**
+ * @file mutual_best_matcher.hpp
+ * @brief Incremental mutual-best selection over Phase 1 candidates
+ */
+
+#pragma once
+
+#include <x3dna/algorithms/pair_identification/candidate_table.hpp>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace x3dna {
+namespace algorithms {
+
+/**
+ * @class MutualBestMatcher
+ * @brief Event-driven equivalent of the legacy find_bestpair selection loop
+ *
+ * Legacy repeats full passes over all residues (ascending legacy index),
+ * pairing residue i with its best unmatched partner j whenever j's best
+ * unmatched partner is i, until a pass adds nothing.
+ *
+ * Here each residue keeps its valid candidates pre-sorted by (score, partner
+ * index) with a cursor that lazily skips matched partners, so its best
+ * partner is the entry under the cursor. A mutual pair stays mutual until it
+ * is matched, and a residue's best partner only changes when that partner is
+ * matched. So after each match only the residues that had the matched
+ * residues as their best are re-evaluated, and any new mutual pair is
+ * scheduled at the (pass, index) where the legacy scan would next visit one
+ * of its members. Selection order and the visiting residue of each pair are
+ * identical to the legacy loop.
+ */
+class MutualBestMatcher {
+public:
+    /**
+     * @brief A selected pair in selection order
+     */
+    struct Match {
+        int legacy_idx1; // Residue whose visit selected the pair
+        int legacy_idx2; // Its best partner
+    };
+
+    /**
+     * @brief Prepare ranked partner queues from a finalized candidate table
+     */
+    explicit MutualBestMatcher(const CandidateTable& table);
+
+    /**
+     * @brief Run selection to completion
+     * @return Pairs in the order legacy find_bestpair selects them
+     */
+    [[nodiscard]] std::vector<Match> run();
+
+    /**
+     * @brief Number of legacy passes the selection corresponds to (including the final empty pass)
+     */
+    [[nodiscard]] int num_passes() const {
+        return num_passes_;
+    }
+
+private:
+    struct RankedPartner {
+        double score;
+        int partner;
+    };
+
+    // (pass, visiting index, partner)
+    using Event = std::tuple<int, int, int>;
+
+    const CandidateTable& table_;
+    int max_legacy_idx_;
+    int num_passes_ = 0;
+
+    std::vector<size_t> queue_start_; // CSR offsets into ranked_, per legacy index
+    std::vector<RankedPartner> ranked_;
+    std::vector<size_t> cursor_;                // Current position in each residue's queue
+    std::vector<bool> matched_;
+    std::vector<std::vector<int>> watchers_;    // watchers_[j]: residues whose best partner is j
+    std::set<Event> events_;
+
+    [[nodiscard]] int best_partner(int idx);
+    void schedule_if_mutual(int idx, int pass, int position);
+};
+
+} // namespace algorithms
+} // namespace x3dna
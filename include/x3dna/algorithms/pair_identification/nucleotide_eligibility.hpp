@@ -0,0 +1,109 @@
+/**
+ * @file nucleotide_eligibility.hpp
+ * @brief Per-structure nucleotide classification, computed once per structure
+ */
+
+#pragma once
+
+#include <x3dna/core/structure.hpp>
+#include <x3dna/core/residue.hpp>
+#include <optional>
+#include <vector>
+
+namespace x3dna {
+namespace algorithms {
+
+/**
+ * @class NucleotideEligibility
+ * @brief Caches which residues count as nucleotides for pair finding
+ *
+ * Standard and recognized modified nucleotides are classified from their
+ * base type. Unknown residues need a least-squares fit of their ring atoms
+ * against the standard base ring (legacy check_nt_type_by_rmsd). That fit
+ * is the expensive part. This table runs it once per residue and keeps the
+ * result, so pair finding loops only read a bit.
+ *
+ * Entries are indexed by legacy residue index. They describe the residue's
+ * atoms only, not whether a reference frame has been set.
+ *
+ * Usage:
+ * @code
+ * NucleotideEligibility eligibility;
+ * eligibility.build(structure);
+ * if (eligibility.is_nucleotide(legacy_idx)) { ... }
+ * @endcode
+ */
+class NucleotideEligibility {
+public:
+    /**
+     * @brief Classify every residue of a structure
+     * @param structure Structure to classify (residues must have legacy indices)
+     * @param num_threads Threads for the RMSD fits (1 = serial, 0 = hardware concurrency)
+     */
+    void build(const core::Structure& structure, int num_threads = 1);
+
+    /**
+     * @brief Clear all entries
+     */
+    void clear();
+
+    /**
+     * @brief Check if residue at legacy index is a nucleotide (false for unknown indices)
+     */
+    [[nodiscard]] bool is_nucleotide(int legacy_idx) const {
+        return in_range(legacy_idx) && entries_[static_cast<size_t>(legacy_idx)].is_nucleotide;
+    }
+
+    /**
+     * @brief Ring RMSD from the nucleotide check, if the fit was run and succeeded
+     */
+    [[nodiscard]] std::optional<double> rmsd(int legacy_idx) const {
+        if (!in_range(legacy_idx)) {
+            return std::nullopt;
+        }
+        return entries_[static_cast<size_t>(legacy_idx)].rmsd;
+    }
+
+    /**
+     * @brief Largest legacy index covered (0 if empty)
+     */
+    [[nodiscard]] int max_legacy_idx() const {
+        return entries_.empty() ? 0 : static_cast<int>(entries_.size()) - 1;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return entries_.empty();
+    }
+
+    /**
+     * @brief Classify a single residue
+     * @param residue Residue to check
+     * @param rmsd_out Receives the ring RMSD when the fit is run (may be nullptr)
+     * @return True if residue is a nucleotide (standard, recognized modified, or passes the RMSD check)
+     */
+    [[nodiscard]] static bool classify(const core::Residue& residue, std::optional<double>* rmsd_out = nullptr);
+
+    /**
+     * @brief Check if residue has enough base ring atoms to attempt a frame fit
+     *
+     * True for nucleotides by residue type, and for residues of unknown
+     * molecule type with at least 3 of the six pyrimidine-ring atoms. Reads
+     * atom types only, so it needs no RMSD fit and no built table.
+     */
+    [[nodiscard]] static bool has_base_ring(const core::Residue& residue);
+
+private:
+    struct Entry {
+        bool is_nucleotide = false;
+        std::optional<double> rmsd;
+    };
+
+    std::vector<Entry> entries_; // Indexed by legacy index; slot 0 unused
+
+    [[nodiscard]] bool in_range(int legacy_idx) const {
+        return legacy_idx > 0 && legacy_idx < static_cast<int>(entries_.size());
+    }
+};
+
+} // namespace algorithms
+} // namespace x3dna
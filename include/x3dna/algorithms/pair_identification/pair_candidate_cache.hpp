@@ -6,10 +6,11 @@
 #pragma once
 
 #include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <x3dna/algorithms/pair_identification/candidate_table.hpp>
+#include <x3dna/algorithms/pair_identification/nucleotide_eligibility.hpp>
 #include <x3dna/algorithms/pair_identification/quality_score_calculator.hpp>
 #include <x3dna/algorithms/pair_identification/residue_index_map.hpp>
 #include <x3dna/core/structure.hpp>
-#include <map>
 #include <vector>
 #include <optional>
 #include <functional>
@@ -17,31 +18,20 @@
 namespace x3dna {
 namespace algorithms {
 
-/**
- * @struct CandidateInfo
- * @brief Information about a validated pair candidate
- */
-struct CandidateInfo {
-    ValidationResult validation;
-    int bp_type_id;
-    double adjusted_quality_score;
-
-    [[nodiscard]] bool is_valid() const {
-        return validation.is_valid;
-    }
-};
-
 /**
  * @class PairCandidateCache
  * @brief Caches validation results for all candidate base pairs
  *
  * Pre-computes and caches validation for all candidate pairs during Phase 1,
- * ensuring consistency between validation and selection phases.
+ * ensuring consistency between validation and selection phases. Results are
+ * held in a CandidateTable, so per-residue candidate lists are contiguous.
  *
  * Usage:
  * @code
  * PairCandidateCache cache;
- * cache.build(structure, validator, quality_calc, is_nucleotide_func);
+ * NucleotideEligibility eligibility;
+ * eligibility.build(structure);
+ * cache.build(structure, validator, quality_calc, eligibility);
  *
  * // Get cached result for a specific pair
  * auto info = cache.get(legacy_idx1, legacy_idx2);
@@ -49,9 +39,11 @@ struct CandidateInfo {
  *     // Use the cached validation result
  * }
  *
- * // Get all valid candidates for a residue
- * for (int partner_idx : cache.valid_partners_for(legacy_idx)) {
- *     // Process each valid partner
+ * // Iterate all candidates for a residue without copying
+ * for (const auto& entry : cache.candidates_for(legacy_idx)) {
+ *     if (entry.is_valid) {
+ *         // entry.partner, entry.score, cache.info(entry)
+ *     }
  * }
  * @endcode
  */
@@ -65,9 +57,23 @@ public:
      * @param validator Validator to use for pair checking
      * @param quality_calc Quality score calculator
      * @param is_nucleotide Function to check if residue is a nucleotide
+     * @param num_threads Threads for pair validation (1 = serial, 0 = hardware concurrency);
+     *                    the cache contents do not depend on it
      */
     void build(const core::Structure& structure, const BasePairValidator& validator,
-               const QualityScoreCalculator& quality_calc, NucleotideChecker is_nucleotide);
+               const QualityScoreCalculator& quality_calc, NucleotideChecker is_nucleotide, int num_threads = 1);
+
+    /**
+     * @brief Build cache using a precomputed nucleotide classification
+     * @param structure Structure with frames calculated
+     * @param validator Validator to use for pair checking
+     * @param quality_calc Quality score calculator
+     * @param eligibility Nucleotide classification built for the same structure
+     * @param num_threads Threads for pair validation (1 = serial, 0 = hardware concurrency)
+     */
+    void build(const core::Structure& structure, const BasePairValidator& validator,
+               const QualityScoreCalculator& quality_calc, const NucleotideEligibility& eligibility,
+               int num_threads = 1);
 
     /**
      * @brief Clear all cached data
@@ -78,14 +84,14 @@ public:
      * @brief Check if cache is empty
      */
     [[nodiscard]] bool empty() const {
-        return cache_.empty();
+        return table_.empty();
     }
 
     /**
      * @brief Get number of cached pairs
      */
     [[nodiscard]] size_t size() const {
-        return cache_.size();
+        return table_.size();
     }
 
     /**
@@ -108,6 +114,30 @@ public:
      */
     [[nodiscard]] bool contains(int legacy_idx1, int legacy_idx2) const;
 
+    /**
+     * @brief Get cached result for a pair without copying (order-independent)
+     * @return Pointer to CandidateInfo or nullptr if pair wasn't cached
+     */
+    [[nodiscard]] const CandidateInfo* find(int legacy_idx1, int legacy_idx2) const {
+        return table_.find(legacy_idx1, legacy_idx2);
+    }
+
+    /**
+     * @brief Contiguous candidate entries for a residue, sorted by partner index
+     *
+     * Entry scores are the adjusted quality score (max() for invalid pairs).
+     */
+    [[nodiscard]] CandidateTable::Row candidates_for(int legacy_idx) const {
+        return table_.row(legacy_idx);
+    }
+
+    /**
+     * @brief Full cached info for a row entry
+     */
+    [[nodiscard]] const CandidateInfo& info(const CandidateEntry& entry) const {
+        return table_.info(entry);
+    }
+
     /**
      * @brief Get all valid partner indices for a residue
      * @param legacy_idx Residue legacy index
@@ -123,10 +153,10 @@ public:
     // ==================== Iteration ====================
 
     /**
-     * @brief Get all cached pairs (for iteration)
+     * @brief Get all cached pairs (for iteration), ordered by (smaller, larger) index
      */
-    [[nodiscard]] const std::map<std::pair<int, int>, CandidateInfo>& all() const {
-        return cache_;
+    [[nodiscard]] const std::vector<CandidateTable::CandidatePair>& all() const {
+        return table_.pairs();
     }
 
     /**
@@ -152,17 +182,12 @@ public:
     }
 
 private:
-    /**
-     * @brief Normalize pair key (smaller index first)
-     */
-    [[nodiscard]] static std::pair<int, int> normalize(int i, int j) {
-        return (i < j) ? std::make_pair(i, j) : std::make_pair(j, i);
-    }
-
-    std::map<std::pair<int, int>, CandidateInfo> cache_;
-    std::map<int, std::vector<int>> valid_partners_; // legacy_idx -> valid partner indices
-    std::map<int, std::vector<int>> all_partners_;   // legacy_idx -> all partner indices
+    CandidateTable table_;
     ResidueIndexMap index_map_;
+
+    // Validate all pairs among eligible legacy indices (ascending) and fill the table
+    void validate_pairs(const std::vector<int>& eligible, const BasePairValidator& validator,
+                        const QualityScoreCalculator& quality_calc, int num_threads);
 };
 
 } // namespace algorithms
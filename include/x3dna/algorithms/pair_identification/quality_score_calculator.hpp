@@ -84,6 +84,20 @@ public:
      */
     [[nodiscard]] double adjust_pair_quality(const std::vector<core::hydrogen_bond>& hbonds) const;
 
+    /**
+     * @brief H-bond quality adjustment from an already counted number of good H-bonds
+     * @param num_good_hb Number of bonds for which is_good_hbond holds
+     */
+    [[nodiscard]] double adjust_pair_quality(int num_good_hb) const;
+
+    /**
+     * @brief Whether one H-bond counts as "good" for adjust_pair_quality
+     *
+     * True for type '-' with the distance, rounded to 0.01 Å as legacy prints
+     * it, in [2.5, 3.5] Å.
+     */
+    [[nodiscard]] static bool is_good_hbond(char type, double distance);
+
     /**
      * @brief Calculate bp_type_id (matches legacy check_wc_wobble_pair)
      *
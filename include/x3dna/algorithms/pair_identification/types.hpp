@@ -6,10 +6,10 @@
 #pragma once
 
 #include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <x3dna/algorithms/pair_identification/candidate_table.hpp>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/io/json_writer.hpp>
 #include <algorithm>
-#include <map>
 #include <vector>
 
 namespace x3dna {
@@ -18,33 +18,33 @@ namespace pair_identification {
 
 /** @brief Results from Phase 1 validation of all pairs */
 struct Phase1Results {
-    std::map<std::pair<int, int>, ValidationResult> validation_results;
-    std::map<std::pair<int, int>, int> bp_type_ids;
+    CandidateTable candidates; // Per-residue candidate rows; entry score is the selection score
 
     [[nodiscard]] const ValidationResult* get_result(int idx1, int idx2) const {
-        auto key = (idx1 < idx2) ? std::make_pair(idx1, idx2) : std::make_pair(idx2, idx1);
-        auto it = validation_results.find(key);
-        return (it != validation_results.end()) ? &it->second : nullptr;
+        const CandidateInfo* info = candidates.find(idx1, idx2);
+        return info ? &info->validation : nullptr;
     }
 
     [[nodiscard]] int get_bp_type_id(int idx1, int idx2) const {
-        auto key = (idx1 < idx2) ? std::make_pair(idx1, idx2) : std::make_pair(idx2, idx1);
-        auto it = bp_type_ids.find(key);
-        return (it != bp_type_ids.end()) ? it->second : 0;
+        const CandidateEntry* entry = candidates.find_entry(idx1, idx2);
+        return entry ? entry->bp_type_id : 0;
     }
 };
 
-/** @brief Mapping between legacy indices and residue pointers */
+/** @brief Mapping between legacy indices and residue pointers (dense, indexed by legacy index) */
 struct ResidueIndexMapping {
-    std::map<int, const core::Residue*> by_legacy_idx;
+    std::vector<const core::Residue*> by_legacy_idx; // Slot 0 unused; nullptr for gaps
     int max_legacy_idx = 0;
+    size_t num_residues = 0;
 
     [[nodiscard]] const core::Residue* get(int legacy_idx) const {
-        auto it = by_legacy_idx.find(legacy_idx);
-        return (it != by_legacy_idx.end()) ? it->second : nullptr;
+        if (legacy_idx < 0 || legacy_idx >= static_cast<int>(by_legacy_idx.size())) {
+            return nullptr;
+        }
+        return by_legacy_idx[legacy_idx];
     }
 
-    [[nodiscard]] bool empty() const { return by_legacy_idx.empty(); }
+    [[nodiscard]] bool empty() const { return num_residues == 0; }
 };
 
 /** @brief Context for partner search - groups related data to reduce parameters */
@@ -12,6 +12,7 @@
 #include <x3dna/core/structure.hpp>
 #include <x3dna/core/atom.hpp>
 #include <x3dna/core/typing/nucleotide_type.hpp>
+#include <x3dna/algorithms/standard_base_templates.hpp>
 #include <x3dna/geometry/vector3d.hpp>
 
 namespace x3dna {
@@ -56,6 +57,24 @@ public:
     [[nodiscard]] static MatchedAtoms match(const core::Residue& residue, const core::Structure& standard_template,
                                             std::optional<core::typing::BaseType> base_type = std::nullopt);
 
+    /**
+     * @brief Match ring atoms against a precomputed ring template, by AtomType
+     * @param residue Experimental residue to match
+     * @param ring_template Ring template from StandardBaseTemplates::ring_template
+     * @param base_type Base type selecting the ring atom list
+     * @param atom_names Receives the matched atom names (appended, in ring_atoms_for_type order)
+     * @param standard_coords Receives the matched template coordinates (appended)
+     * @param experimental_coords Receives the matched residue coordinates (appended)
+     * @return Number of matched atom pairs
+     *
+     * Same pairs in the same order as match(); residue atoms are looked up by their
+     * classified AtomType instead of by name.
+     */
+    static size_t match(const core::Residue& residue, const RingTemplate& ring_template,
+                        core::typing::BaseType base_type, std::vector<std::string>& atom_names,
+                        std::vector<geometry::Vector3D>& standard_coords,
+                        std::vector<geometry::Vector3D>& experimental_coords);
+
     /**
      * @brief Get list of ring atom names for a base type
      * @param base_type Base type (ADENINE, CYTOSINE, etc.)
@@ -5,24 +5,56 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <x3dna/core/structure.hpp>
 #include <x3dna/core/residue.hpp>
+#include <x3dna/core/typing/atom_type.hpp>
 #include <x3dna/core/typing/nucleotide_type.hpp>
+#include <x3dna/geometry/vector3d.hpp>
 #include <x3dna/io/pdb_parser.hpp>
 
 namespace x3dna {
 namespace algorithms {
 
+/**
+ * @struct RingTemplate
+ * @brief Ring-atom coordinates of one standard base template
+ *
+ * Slots are indexed by the ring AtomType value (C4 = 1 ... N9 = 9; slot 0 is unused).
+ * For each ring atom the first occurrence in the template file is kept, as in a
+ * name search over the template structure.
+ */
+struct RingTemplate {
+    static constexpr size_t NUM_SLOTS = core::typing::NUM_RING_ATOM_TYPES + 1;
+
+    std::array<geometry::Vector3D, NUM_SLOTS> coords{}; // Template coordinates by ring AtomType
+    std::array<bool, NUM_SLOTS> present{};              // Whether the template has the atom
+    std::filesystem::path file;                         // Template file the coordinates came from
+
+    [[nodiscard]] bool has(core::typing::AtomType type) const {
+        const auto slot = static_cast<size_t>(type);
+        return slot < NUM_SLOTS && present[slot];
+    }
+
+    [[nodiscard]] const geometry::Vector3D& position(core::typing::AtomType type) const {
+        return coords[static_cast<size_t>(type)];
+    }
+};
+
 /**
  * @class StandardBaseTemplates
  * @brief Loads and caches standard base PDB template files
  *
  * Standard templates are ideal base geometries used for frame calculation.
  * Template files are named: Atomic_A.pdb, Atomic_C.pdb, Atomic_G.pdb, etc.
+ *
+ * load_template and ring_template may be called from several threads at once;
+ * the caches are guarded by a mutex. Changing the template path is not thread-safe.
  */
 class StandardBaseTemplates {
 public:
@@ -40,6 +72,12 @@ public:
      */
     explicit StandardBaseTemplates(const std::filesystem::path& template_path);
 
+    /**
+     * @brief Copy path, parser and cached templates (the mutex is not shared)
+     */
+    StandardBaseTemplates(const StandardBaseTemplates& other);
+    StandardBaseTemplates& operator=(const StandardBaseTemplates& other);
+
     /**
      * @brief Load standard base template for a base type
      * @param type Base type (ADENINE, CYTOSINE, GUANINE, THYMINE, URACIL)
@@ -56,6 +94,15 @@ public:
      */
     [[nodiscard]] core::Structure load_template(core::typing::BaseType type);
 
+    /**
+     * @brief Ring-atom coordinates of a standard base template, built once per template
+     * @param type Base type
+     * @param is_modified If true, use lowercase template (Atomic.x.pdb) for modified nucleotides
+     * @return Cached ring template; valid until clear_cache() or set_template_path()
+     * @throws std::runtime_error if template file cannot be found or loaded
+     */
+    [[nodiscard]] const RingTemplate& ring_template(core::typing::BaseType type, bool is_modified);
+
     /**
      * @brief Get template file path for a base type
      * @param type Base type
@@ -100,6 +147,8 @@ public:
 private:
     std::filesystem::path template_path_;
     std::map<core::typing::BaseType, std::shared_ptr<core::Structure>> cache_;
+    std::map<core::typing::BaseType, std::shared_ptr<const RingTemplate>> ring_cache_;
+    mutable std::mutex cache_mutex_; // Guards cache_ and ring_cache_
     io::PdbParser parser_;
 
     /**
@@ -123,6 +172,16 @@ private:
      * @return true if file exists
      */
     [[nodiscard]] static bool file_exists(const std::filesystem::path& path);
+
+    /**
+     * @brief Cached template structure, parsed on a miss; caller must hold cache_mutex_
+     */
+    [[nodiscard]] const core::Structure& load_template_locked(core::typing::BaseType type, bool is_modified);
+
+    /**
+     * @brief Cache key for a template (type * 2 + is_modified)
+     */
+    [[nodiscard]] static core::typing::BaseType cache_key(core::typing::BaseType type, bool is_modified);
 };
 
 } // namespace algorithms
@@ -0,0 +1,62 @@
+/**
+ * @file hbond_atom_cache.hpp
+ * @brief Per-residue H-bond atom indices
+ *
+ * Lets BasePairValidator index each residue's polar atoms once and reuse
+ * the index for every pair the residue is validated against.
+ */
+
+#pragma once
+
+#include <vector>
+#include <x3dna/core/residue.hpp>
+#include <x3dna/algorithms/hydrogen_bond/detector.hpp>
+
+namespace x3dna {
+namespace algorithms {
+namespace validation {
+
+/**
+ * @brief HBondAtomIndex for a list of residues, indexed by position in the list
+ *
+ * Same layout as RingDataCache: built once, read-only afterwards. All entries
+ * come from one detector, so they share its allowed elements.
+ *
+ * Usage:
+ *   HBondAtomCache cache;
+ *   cache.build(residues, detector);
+ *   const auto& index = cache[i];
+ */
+class HBondAtomCache {
+public:
+    HBondAtomCache() = default;
+
+    /**
+     * @brief Index the polar atoms of every residue, replacing any previous contents
+     * @param residues Residues to index; entry i belongs to residues[i]
+     * @param detector Detector that builds the indices
+     */
+    void build(const std::vector<const core::Residue*>& residues, const hydrogen_bond::HBondDetector& detector);
+
+    /**
+     * @brief H-bond atom index of the residue at a given position of the build list
+     */
+    [[nodiscard]] const hydrogen_bond::HBondAtomIndex& operator[](size_t index) const { return data_[index]; }
+
+    /**
+     * @brief Clear all cached data
+     */
+    void clear();
+
+    /**
+     * @brief Get number of cached entries
+     */
+    [[nodiscard]] size_t size() const { return data_.size(); }
+
+private:
+    std::vector<hydrogen_bond::HBondAtomIndex> data_; // Dense, by build-list position
+};
+
+} // namespace validation
+} // namespace algorithms
+} // namespace x3dna
@@ -19,7 +19,7 @@ namespace algorithms {
 namespace validation {
 
 // Forward declaration
-class RingDataCache;
+struct ResidueRingData;
 
 /**
  * @struct Point2D
@@ -60,21 +60,22 @@ public:
                                           const geometry::Vector3D& average_z_axis);
 
     /**
-     * @brief Calculate overlap area using cached ring data (faster for batch processing)
-     * @param res1 First nucleotide residue
-     * @param res2 Second nucleotide residue
+     * @brief Calculate overlap area using precomputed ring data (faster for batch processing)
+     * @param ring1 ResidueRingData::compute of the first residue
+     * @param ring2 ResidueRingData::compute of the second residue
      * @param average_origin Average origin of the two reference frames
      * @param average_z_axis Average z-axis of the two reference frames
-     * @param cache Ring data cache for O(1) ring coordinate lookup
      * @return Overlap area in square Angstroms
      *
-     * Uses pre-computed ring atom indices and exocyclic mappings from the cache,
-     * avoiding repeated O(n) lookups when the same residue appears in multiple pairs.
+     * Uses the cached polygon vertices of each residue, so a pair only costs the plane
+     * projection. Pairs whose bounding circles, or projected bounding boxes, are apart
+     * return 0 before the polygon intersection; every other pair gets the same area as
+     * the full calculation. Reads only its arguments, so it is safe to call from several
+     * threads.
      */
-    [[nodiscard]] static double calculate(const core::Residue& res1, const core::Residue& res2,
+    [[nodiscard]] static double calculate(const ResidueRingData& ring1, const ResidueRingData& ring2,
                                           const geometry::Vector3D& average_origin,
-                                          const geometry::Vector3D& average_z_axis,
-                                          RingDataCache& cache);
+                                          const geometry::Vector3D& average_z_axis);
 
     /**
      * @brief Extract ring coordinates with exocyclic substituents for a residue
@@ -109,6 +110,18 @@ public:
 private:
     /// Maximum polygon vertices supported (matches legacy MNPOLY constant)
     static constexpr long MAX_POLYGON_VERTICES = 1000;
+
+    /// Polygons up to this size are scaled in stack buffers
+    static constexpr long STACK_POLYGON_VERTICES = 16;
+
+    /// Gap (Angstroms) by which bounding shapes must miss for the early exit to skip a pair
+    static constexpr double SEPARATION_MARGIN = 1e-3;
+
+    /**
+     * @brief calculate_polygon_intersection over raw vertex arrays
+     */
+    [[nodiscard]] static double polygon_intersection_area(const Point2D* polygon_a, long num_vertices_a,
+                                                          const Point2D* polygon_b, long num_vertices_b);
 };
 
 }  // namespace validation
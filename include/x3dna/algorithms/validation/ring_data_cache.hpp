@@ -1,15 +1,14 @@
 /**
  * @file ring_data_cache.hpp
- * @brief Cache for pre-computed ring atom data per residue
+ * @brief Pre-computed ring atom data per residue
  *
- * Optimizes overlap calculation by caching ring atom indices and
- * exocyclic atom mapping, avoiding repeated O(n) lookups.
+ * Optimizes overlap calculation by computing ring atom indices and
+ * exocyclic atom mapping once per residue, avoiding repeated O(n) lookups.
  */
 
 #pragma once
 
 #include <vector>
-#include <unordered_map>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/geometry/vector3d.hpp>
 
@@ -29,40 +28,51 @@ struct ResidueRingData {
                                                  // (same index as ring_atom if no exocyclic found)
     bool is_purine = false;                      // True if 9 ring atoms, false if 6
     bool is_valid = false;                       // True if at least 3 ring atoms found
+
+    // Overlap polygon vertices: position of atoms[exocyclic_atom_indices[i]] for each ring atom
+    std::vector<geometry::Vector3D> polygon_positions;
+    geometry::Vector3D polygon_center; // Centroid of polygon_positions
+    double polygon_radius = 0.0;       // Largest distance from polygon_center to a vertex
+
+    /**
+     * @brief Compute ring data for a residue
+     */
+    [[nodiscard]] static ResidueRingData compute(const core::Residue& residue);
+
+    /**
+     * @brief Ring coordinates relative to oave
+     * @param oave The average origin point
+     * @return Vector of ring coordinates (using exocyclic atoms where available)
+     */
+    [[nodiscard]] std::vector<geometry::Vector3D> ring_coords(const geometry::Vector3D& oave) const;
 };
 
 /**
- * @brief Cache for ResidueRingData keyed by residue res_id
+ * @brief ResidueRingData for a list of residues, indexed by position in the list
  *
- * Thread-safe caching of ring atom data. The cache key is res_id string
- * to handle residue copies safely.
+ * Built once when a structure is prepared for validation and read-only
+ * afterwards, so lookups are plain array indexing and the cache can be
+ * shared by any number of threads.
  *
  * Usage:
  *   RingDataCache cache;
- *   const auto& data = cache.get_or_compute(residue);
- *   auto coords = cache.get_ring_coords(residue, oave);
+ *   cache.build(residues);
+ *   auto coords = cache[i].ring_coords(oave);
  */
 class RingDataCache {
 public:
     RingDataCache() = default;
 
     /**
-     * @brief Get or compute ring data for a residue
-     * @param residue The residue to get ring data for
-     * @return Cached or newly computed ResidueRingData
+     * @brief Compute ring data for every residue, replacing any previous contents
+     * @param residues Residues to prepare; entry i belongs to residues[i]
      */
-    const ResidueRingData& get_or_compute(const core::Residue& residue);
+    void build(const std::vector<const core::Residue*>& residues);
 
     /**
-     * @brief Get ring coordinates relative to oave
-     * @param residue The residue
-     * @param oave The average origin point
-     * @return Vector of ring coordinates (using exocyclic atoms where available)
-     *
-     * This combines cached ring data with runtime oave to produce final coordinates.
+     * @brief Ring data of the residue at a given position of the build list
      */
-    std::vector<geometry::Vector3D> get_ring_coords(const core::Residue& residue,
-                                                     const geometry::Vector3D& oave);
+    [[nodiscard]] const ResidueRingData& operator[](size_t index) const { return data_[index]; }
 
     /**
      * @brief Clear all cached data
@@ -72,15 +82,10 @@ public:
     /**
      * @brief Get number of cached entries
      */
-    [[nodiscard]] size_t size() const { return cache_.size(); }
+    [[nodiscard]] size_t size() const { return data_.size(); }
 
 private:
-    /**
-     * @brief Compute ring data for a residue (internal)
-     */
-    static ResidueRingData compute_ring_data(const core::Residue& residue);
-
-    std::unordered_map<std::string, ResidueRingData> cache_; // Keyed by res_id
+    std::vector<ResidueRingData> data_; // Dense, by build-list position
 };
 
 } // namespace validation
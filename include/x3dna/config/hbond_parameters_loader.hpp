@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <string>
 #include <optional>
+#include <mutex>
 
 namespace x3dna {
 namespace config {
@@ -130,6 +131,7 @@ private:
     // Singleton storage
     static std::optional<HBondParameters> cached_params_;
     static nlohmann::json cached_json_;
+    static std::recursive_mutex cache_mutex_; // Guards the cache when validation runs on worker threads
 };
 
 } // namespace config
@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <x3dna/geometry/vector3d.hpp>
 #include <x3dna/core/constants.hpp>
+#include <x3dna/core/interned_names.hpp>
 #include <x3dna/core/string_utils.hpp>
 #include <x3dna/core/typing/atom_classification.hpp>
 
@@ -24,6 +26,12 @@ namespace core {
  *
  * Note: Atom names are trimmed on construction and stored without padding.
  * The original PDB 4-character format is not preserved (no longer needed after removing original_atom_name_).
+ *
+ * Storage is selected at build time; the accessors are the same in every layout:
+ * - X3DNA_COMPACT_ATOMS stores the name and element as InternedNames IDs and
+ *   the model number in 16 bits. Results are unchanged.
+ * - X3DNA_FLOAT_COORDINATES stores the position, occupancy and B-factor as
+ *   float. position() then returns by value, and results change at float precision.
  */
 class Atom {
 public:
@@ -46,10 +54,12 @@ public:
      *
      * Also classifies the atom type at construction time for O(1) lookup later.
      */
-    Atom(const std::string& name, const geometry::Vector3D& position)
-        : name_(trim(name)),
-          position_(position),
-          standard_atom_(typing::AtomClassifier::get_atom_type(name_)) {}
+    Atom(const std::string& name, const geometry::Vector3D& position) {
+        const std::string trimmed = trim(name);
+        name_ = make_name_field(trimmed);
+        set_position(position);
+        standard_atom_ = typing::AtomClassifier::get_atom_type(trimmed);
+    }
 
     /**
      * @brief Create a Builder for fluent atom construction
@@ -65,7 +75,7 @@ public:
      * @brief Get atom name (trimmed, without padding)
      */
     [[nodiscard]] const std::string& name() const {
-        return name_;
+        return name_field_value(name_);
     }
 
     /**
@@ -74,12 +84,18 @@ public:
      * @return True if names match after trimming
      */
     [[nodiscard]] bool name_matches(const std::string& name_to_match) const {
-        return name_ == trim(name_to_match);
+        return name() == trim(name_to_match);
     }
 
+#ifdef X3DNA_FLOAT_COORDINATES
+    [[nodiscard]] geometry::Vector3D position() const {
+        return geometry::Vector3D(position_[0], position_[1], position_[2]);
+    }
+#else
     [[nodiscard]] const geometry::Vector3D& position() const {
         return position_;
     }
+#endif
 
     [[nodiscard]] char alt_loc() const {
         return alt_loc_;
@@ -98,7 +114,7 @@ public:
         return b_factor_;
     }
     [[nodiscard]] const std::string& element() const {
-        return element_;
+        return name_field_value(element_);
     }
     [[nodiscard]] int legacy_atom_idx() const {
         return legacy_atom_idx_;
@@ -112,7 +128,7 @@ public:
      * @brief Set model number (from MODEL record, set after parsing atom line)
      */
     void set_model_number(int model_number) {
-        model_number_ = model_number;
+        model_number_ = static_cast<ModelNumber>(model_number);
     }
 
     /**
@@ -128,7 +144,7 @@ public:
      * @return Distance in Angstroms
      */
     [[nodiscard]] double distance_to(const Atom& other) const {
-        return position_.distance_to(other.position_);
+        return position().distance_to(other.position());
     }
 
     /**
@@ -192,7 +208,7 @@ public:
      * named "N7" will only get AtomType::N7 if the molecule is a nucleic acid.
      */
     void update_atom_type(typing::MoleculeType molecule_type) {
-        standard_atom_ = typing::AtomClassifier::get_atom_type(name_, molecule_type);
+        standard_atom_ = typing::AtomClassifier::get_atom_type(name(), molecule_type);
     }
 
     /**
@@ -211,7 +227,7 @@ public:
      */
     [[nodiscard]] bool is_hydrogen_bond_donor() const {
         // Common H-bond donors: N with H (N1, N2, N3, N4, N6, N7, N9)
-        return (name_.find("N") == 0 && name_.length() <= 2);
+        return (name().find("N") == 0 && name().length() <= 2);
     }
 
     /**
@@ -220,43 +236,66 @@ public:
      */
     [[nodiscard]] bool is_hydrogen_bond_acceptor() const {
         // Common H-bond acceptors: O (O2, O4, O6), N (N3, N7)
-        return (name_.find("O") == 0 || name_ == "N3" || name_ == "N7");
+        return (name().find("O") == 0 || name() == "N3" || name() == "N7");
     }
 
     /**
      * @brief Check if this is a backbone atom (P, OP1, OP2, O5', O3', etc.)
      */
     [[nodiscard]] bool is_backbone_atom() const {
-        return typing::AtomClassifier::is_backbone_atom(name_);
+        return typing::AtomClassifier::is_backbone_atom(name());
     }
 
     /**
      * @brief Check if this is a sugar atom (C1', C2', C3', C4', C5', O4', etc.)
      */
     [[nodiscard]] bool is_sugar_atom() const {
-        return typing::AtomClassifier::is_sugar_atom(name_);
+        return typing::AtomClassifier::is_sugar_atom(name());
     }
 
     /**
      * @brief Check if this is a nucleobase atom (N1, C2, N3, C4, C5, C6, etc.)
      */
     [[nodiscard]] bool is_nucleobase_atom() const {
-        return typing::AtomClassifier::is_nucleobase_atom(name_);
+        return typing::AtomClassifier::is_nucleobase_atom(name());
     }
 
 private:
     friend class Builder;
 
-    std::string name_;            // Atom name (trimmed, without padding)
-    geometry::Vector3D position_; // 3D coordinates
-    AtomType standard_atom_ = AtomType::UNKNOWN; // Cached atom type for fast comparison
-    char alt_loc_ = ' ';          // Alternate location indicator (PDB column 17)
-    double occupancy_ = 1.0;      // Occupancy (PDB columns 55-60, default 1.0)
+#ifdef X3DNA_FLOAT_COORDINATES
+    using Real = float;
+    using Position = std::array<float, 3>;
+#else
+    using Real = double;
+    using Position = geometry::Vector3D;
+#endif
+#ifdef X3DNA_COMPACT_ATOMS
+    using ModelNumber = int16_t;
+#else
+    using ModelNumber = int;
+#endif
+
+    void set_position(const geometry::Vector3D& position) {
+#ifdef X3DNA_FLOAT_COORDINATES
+        position_ = {static_cast<float>(position.x()), static_cast<float>(position.y()),
+                     static_cast<float>(position.z())};
+#else
+        position_ = position;
+#endif
+    }
+
+    // Members ordered largest first so the compact layouts pack without padding
+    Position position_{};         // 3D coordinates
+    Real occupancy_ = 1.0;        // Occupancy (PDB columns 55-60, default 1.0)
+    Real b_factor_ = 0.0;         // B-factor/temperature factor (PDB column 61-66)
+    NameField name_{};            // Atom name (trimmed, without padding)
+    NameField element_{};         // Element symbol (PDB column 77-78)
     int atom_serial_ = 0;         // Atom serial number (PDB column 7-11)
-    int model_number_ = 0;        // Model number (from MODEL record, 0 if none)
-    double b_factor_ = 0.0;       // B-factor/temperature factor (PDB column 61-66)
-    std::string element_;         // Element symbol (PDB column 77-78)
     int legacy_atom_idx_ = 0;     // Legacy atom index for direct comparison (0 if not set)
+    ModelNumber model_number_ = 0; // Model number (from MODEL record, 0 if none)
+    AtomType standard_atom_ = AtomType::UNKNOWN; // Cached atom type for fast comparison
+    char alt_loc_ = ' ';          // Alternate location indicator (PDB column 17)
 };
 
 /**
@@ -280,11 +319,7 @@ public:
      *
      * Also classifies the atom type at construction time for O(1) lookup later.
      */
-    Builder(const std::string& name, const geometry::Vector3D& position) {
-        atom_.name_ = trim(name);
-        atom_.position_ = position;
-        atom_.standard_atom_ = typing::AtomClassifier::get_atom_type(atom_.name_);
-    }
+    Builder(const std::string& name, const geometry::Vector3D& position) : atom_(name, position) {}
 
     Builder& alt_loc(char loc) {
         atom_.alt_loc_ = loc;
@@ -292,7 +327,7 @@ public:
     }
 
     Builder& occupancy(double occ) {
-        atom_.occupancy_ = occ;
+        atom_.occupancy_ = static_cast<Real>(occ);
         return *this;
     }
 
@@ -302,17 +337,17 @@ public:
     }
 
     Builder& model_number(int num) {
-        atom_.model_number_ = num;
+        atom_.model_number_ = static_cast<ModelNumber>(num);
         return *this;
     }
 
     Builder& b_factor(double bf) {
-        atom_.b_factor_ = bf;
+        atom_.b_factor_ = static_cast<Real>(bf);
         return *this;
     }
 
     Builder& element(const std::string& elem) {
-        atom_.element_ = elem;
+        atom_.element_ = make_name_field(elem);
         return *this;
     }
 
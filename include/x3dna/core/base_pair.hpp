@@ -9,6 +9,7 @@
 #include <vector>
 #include <cmath>
 #include <optional>
+#include <utility>
 #include <nlohmann/json.hpp>
 #include <x3dna/core/reference_frame.hpp>
 #include <x3dna/algorithms/hydrogen_bond/types.hpp>
@@ -213,6 +214,9 @@ public:
     void set_hydrogen_bonds(const std::vector<hydrogen_bond>& hbonds) {
         hbonds_ = hbonds;
     }
+    void set_hydrogen_bonds(std::vector<hydrogen_bond>&& hbonds) {
+        hbonds_ = std::move(hbonds);
+    }
 
     /**
      * @brief Calculate distance between origins of the two reference frames
@@ -0,0 +1,98 @@
+/**
+ * @file interned_names.hpp
+ * @brief Process-wide table of interned atom, element and residue names
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace x3dna {
+namespace core {
+
+/**
+ * @class InternedNames
+ * @brief Maps short names to stable uint16_t IDs
+ *
+ * With X3DNA_COMPACT_ATOMS, atoms store their name and element, and residues
+ * their name, chain ID and insertion code, as IDs into this table instead of
+ * std::string. A structure has only a few hundred distinct names, so one copy
+ * of each serves every atom.
+ *
+ * ID 0 is the empty string. An interned string never moves, so name() returns
+ * a reference that stays valid for the life of the process. intern() is
+ * thread-safe; name() takes no lock and is safe for any ID returned by
+ * intern().
+ */
+class InternedNames {
+public:
+    using Id = uint16_t;
+
+    /// Number of distinct names the table can hold
+    static constexpr size_t MAX_NAMES = size_t{1} << 16;
+
+    /**
+     * @brief Get the ID of a name, adding it on first use
+     * @throws std::runtime_error if the table already holds MAX_NAMES names
+     */
+    [[nodiscard]] static Id intern(std::string_view name);
+
+    /**
+     * @brief Get the string for an ID returned by intern()
+     */
+    [[nodiscard]] static const std::string& name(Id id) {
+        return chunks()[id >> CHUNK_BITS][id & CHUNK_MASK];
+    }
+
+    /**
+     * @brief Number of names interned so far (including the empty string)
+     */
+    [[nodiscard]] static size_t size();
+
+private:
+    static constexpr size_t CHUNK_BITS = 8;
+    static constexpr size_t CHUNK_SIZE = size_t{1} << CHUNK_BITS;
+    static constexpr size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+    // Fixed-size chunks allocated on demand, so strings never move as the table grows
+    using Chunks = std::array<std::unique_ptr<std::string[]>, MAX_NAMES / CHUNK_SIZE>;
+
+    // Function-local so atoms built during static initialization can use the table
+    static Chunks& chunks() {
+        static Chunks chunks = make_chunks();
+        return chunks;
+    }
+    static Chunks make_chunks();
+};
+
+#ifdef X3DNA_COMPACT_ATOMS
+/// Storage for a name field of Atom and Residue: an interned ID
+using NameField = InternedNames::Id;
+
+[[nodiscard]] inline NameField make_name_field(std::string_view name) {
+    return InternedNames::intern(name);
+}
+
+[[nodiscard]] inline const std::string& name_field_value(NameField field) {
+    return InternedNames::name(field);
+}
+#else
+/// Storage for a name field of Atom and Residue: the string itself
+using NameField = std::string;
+
+[[nodiscard]] inline NameField make_name_field(std::string_view name) {
+    return std::string(name);
+}
+
+[[nodiscard]] inline const std::string& name_field_value(const NameField& field) {
+    return field;
+}
+#endif
+
+} // namespace core
+} // namespace x3dna
@@ -12,6 +12,7 @@
 #include <cctype>
 #include <limits>
 #include <x3dna/core/atom.hpp>
+#include <x3dna/core/interned_names.hpp>
 #include <x3dna/core/reference_frame.hpp>
 #include <x3dna/core/typing/residue_classification.hpp>
 #include <x3dna/core/typing/type_registry.hpp>
@@ -28,6 +29,9 @@ namespace core {
  * 1. Simple constructor: Residue(name, seq_num, chain_id) - for basic creation
  * 2. Builder pattern: Residue::create(name, seq_num, chain_id).type(...).build() - for full control
  * 3. Residue::create_from_atoms() - recommended for proper property initialization
+ *
+ * With X3DNA_COMPACT_ATOMS the name, chain ID and insertion code are stored
+ * as InternedNames IDs; the accessors still return const std::string&.
  */
 class Residue {
 public:
@@ -46,9 +50,10 @@ public:
      * @param insertion Insertion code (PDB column 27, default "")
      */
     Residue(const std::string& name, int seq_num, const std::string& chain_id, const std::string& insertion = "")
-        : name_(trim(name)), seq_num_(seq_num), chain_id_(chain_id), insertion_(insertion) {
+        : name_(make_name_field(trim(name))), seq_num_(seq_num), chain_id_(make_name_field(chain_id)),
+          insertion_(make_name_field(insertion)) {
         // Auto-initialize classification from trimmed name
-        classification_ = typing::TypeRegistry::instance().classify_residue(name_);
+        classification_ = typing::TypeRegistry::instance().classify_residue(this->name());
     }
 
     /**
@@ -121,16 +126,16 @@ public:
 
     // Getters
     [[nodiscard]] const std::string& name() const {
-        return name_;
+        return name_field_value(name_);
     }
     [[nodiscard]] int seq_num() const {
         return seq_num_;
     }
     [[nodiscard]] const std::string& chain_id() const {
-        return chain_id_;
+        return name_field_value(chain_id_);
     }
     [[nodiscard]] const std::string& insertion() const {
-        return insertion_;
+        return name_field_value(insertion_);
     }
 
     /**
@@ -143,9 +148,9 @@ public:
      *   "B-PSU-25" (chain B, pseudouridine, position 25)
      */
     [[nodiscard]] std::string res_id() const {
-        std::string id = chain_id_ + "-" + name_ + "-" + std::to_string(seq_num_);
-        if (!insertion_.empty()) {
-            id += insertion_;
+        std::string id = chain_id() + "-" + name() + "-" + std::to_string(seq_num_);
+        if (!insertion().empty()) {
+            id += insertion();
         }
         return id;
     }
@@ -160,9 +165,9 @@ public:
      *   "B.2MG25"   (chain B, modified guanine 2MG, position 25)
      */
     [[nodiscard]] std::string dssr_res_id() const {
-        std::string id = chain_id_ + "." + name_ + std::to_string(seq_num_);
-        if (!insertion_.empty()) {
-            id += "^" + insertion_;
+        std::string id = chain_id() + "." + name() + std::to_string(seq_num_);
+        if (!insertion().empty()) {
+            id += "^" + insertion();
         }
         return id;
     }
@@ -497,10 +502,10 @@ public:
 private:
     friend class Builder;
 
-    std::string name_;                              // Residue name (typically trimmed, e.g., "A", "ADE", "PSU")
+    NameField name_{};                              // Residue name (typically trimmed, e.g., "A", "ADE", "PSU")
     int seq_num_ = 0;                               // Sequence number
-    std::string chain_id_;                          // Chain identifier
-    std::string insertion_;                         // Insertion code (PDB column 27)
+    NameField chain_id_{};                          // Chain identifier
+    NameField insertion_{};                         // Insertion code (PDB column 27)
     std::vector<Atom> atoms_;                       // Atoms in this residue
     std::optional<ReferenceFrame> reference_frame_; // Reference frame (if calculated)
     typing::ResidueClassification classification_;  // Full hierarchical classification
@@ -527,13 +532,13 @@ public:
      * @param chain_id Chain identifier
      */
     Builder(const std::string& name, int seq_num, const std::string& chain_id) {
-        residue_.name_ = trim(name);
+        residue_.name_ = make_name_field(trim(name));
         residue_.seq_num_ = seq_num;
-        residue_.chain_id_ = chain_id;
+        residue_.chain_id_ = make_name_field(chain_id);
     }
 
     Builder& insertion(const std::string& ins) {
-        residue_.insertion_ = ins;
+        residue_.insertion_ = make_name_field(ins);
         return *this;
     }
 
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include <tuple>
 #include <x3dna/core/chain.hpp>
 #include <x3dna/core/residue.hpp>
@@ -19,6 +20,12 @@ namespace core {
 /**
  * @class Structure
  * @brief Represents a complete PDB structure with chains, residues, and atoms
+ *
+ * The legacy residue order and the legacy index -> residue table are built on
+ * first use and cached. add_chain(), set_legacy_indices() and every non-const
+ * access to the chains drop the cache, so it is rebuilt after a mutation.
+ * Mutating through a chain reference obtained before a legacy-order lookup
+ * requires another non-const access before the next lookup.
  */
 class Structure {
 public:
@@ -41,6 +48,7 @@ public:
         return chains_;
     }
     std::vector<Chain>& chains() {
+        legacy_index_.reset();
         return chains_;
     }
     [[nodiscard]] size_t num_chains() const {
@@ -55,9 +63,11 @@ public:
         return chains_.end();
     }
     [[nodiscard]] auto begin() {
+        legacy_index_.reset();
         return chains_.begin();
     }
     [[nodiscard]] auto end() {
+        legacy_index_.reset();
         return chains_.end();
     }
     [[nodiscard]] size_t size() const {
@@ -70,6 +80,7 @@ public:
         return chains_[idx];
     }
     [[nodiscard]] Chain& operator[](size_t idx) {
+        legacy_index_.reset();
         return chains_[idx];
     }
 
@@ -104,6 +115,7 @@ public:
      * @brief Add a chain to this structure
      */
     void add_chain(const Chain& chain) {
+        legacy_index_.reset();
         chains_.push_back(chain);
     }
 
@@ -114,6 +126,7 @@ public:
      */
     void set_legacy_indices(const std::map<std::tuple<std::string, int, std::string, std::string>, int>& atom_idx_map,
                             const std::map<std::tuple<std::string, int, std::string>, int>& residue_idx_map) {
+        legacy_index_.reset();
         for (auto& chain : chains_) {
             for (auto& residue : chain.residues()) {
                 const std::string& chain_id = residue.chain_id();
@@ -181,16 +194,17 @@ public:
      * - Returns unique residues in order they first appear
      *
      * This matches the legacy residue indexing used throughout the codebase.
+     * Built once and cached until the structure is mutated.
      *
-     * @return Vector of residue pointers in legacy order (non-owning)
+     * @return Residue pointers in legacy order (non-owning), valid until the structure is mutated
      */
-    [[nodiscard]] std::vector<const Residue*> residues_in_legacy_order() const;
+    [[nodiscard]] const std::vector<const Residue*>& residues_in_legacy_order() const;
 
     /**
      * @brief Get residue by legacy index (1-based)
      *
      * Finds the residue that would be at the given legacy index when counting
-     * in legacy order (PDB file order).
+     * in legacy order (PDB file order). O(1) lookup in the cached index table.
      *
      * @param legacy_idx Legacy residue index (1-based)
      * @return Pointer to residue, or nullptr if not found
@@ -260,6 +274,47 @@ private:
     // Structure resolution in Angstroms (0.0 = unknown/not applicable)
     double resolution_ = 0.0;
 
+    // Legacy order and legacy index -> residue table, built together on first use
+    struct LegacyIndex {
+        std::vector<const Residue*> order;    // Residues with legacy_residue_idx > 0, by that index
+        std::vector<const Residue*> by_index; // by_index[legacy_idx]; nullptr for gaps and slot 0
+    };
+
+    // Shared pointer swapped atomically so concurrent const lookups may build it.
+    // Copies start empty: the cached pointers refer to the source structure's residues.
+    class LegacyIndexCache {
+    public:
+        LegacyIndexCache() = default;
+        LegacyIndexCache(const LegacyIndexCache&) {}
+        LegacyIndexCache& operator=(const LegacyIndexCache&) {
+            reset();
+            return *this;
+        }
+
+        [[nodiscard]] std::shared_ptr<const LegacyIndex> load() const {
+            return std::atomic_load(&index_);
+        }
+
+        // Publish a freshly built index unless another thread won; index becomes the published one
+        void publish(std::shared_ptr<const LegacyIndex>& index) const {
+            std::shared_ptr<const LegacyIndex> expected;
+            if (!std::atomic_compare_exchange_strong(&index_, &expected, index)) {
+                index = std::move(expected);
+            }
+        }
+
+        void reset() {
+            std::atomic_store(&index_, std::shared_ptr<const LegacyIndex>());
+        }
+
+    private:
+        mutable std::shared_ptr<const LegacyIndex> index_;
+    };
+
+    LegacyIndexCache legacy_index_;
+
+    [[nodiscard]] const LegacyIndex& legacy_index() const;
+
 public:
     // Resolution accessors
     /**
@@ -0,0 +1,103 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Work-stealing thread pool for data-parallel loops
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace x3dna {
+namespace core {
+
+/**
+ * @class ThreadPool
+ * @brief Persistent worker threads running indexed tasks with work stealing
+ *
+ * parallel_for() deals task indices to per-worker queues in contiguous
+ * blocks; a worker pops from the front of its own queue and, once empty,
+ * steals from the back of another worker's queue. The calling thread acts
+ * as worker 0, so a pool of one thread runs everything inline.
+ *
+ * Callers that need deterministic output write results into per-task
+ * slots and merge them in task order afterwards.
+ *
+ * Usage:
+ * @code
+ * ThreadPool pool(4);
+ * std::vector<double> out(n);
+ * pool.parallel_for(n, [&](size_t task, size_t worker) { out[task] = compute(task, worker); });
+ * @endcode
+ */
+class ThreadPool {
+public:
+    using TaskFunction = std::function<void(size_t task, size_t worker)>;
+
+    /**
+     * @brief Create a pool
+     * @param num_threads Total threads including the caller (0 = hardware concurrency)
+     */
+    explicit ThreadPool(size_t num_threads = 0);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Number of threads that execute tasks (including the caller)
+     */
+    [[nodiscard]] size_t num_threads() const {
+        return queues_.size();
+    }
+
+    /**
+     * @brief Run fn(task, worker) for every task in [0, num_tasks) and wait for completion
+     * @param num_tasks Number of tasks
+     * @param fn Task body; worker is in [0, num_threads()) and identifies per-thread state
+     * @throws The first exception thrown by any task (after all tasks have finished)
+     *
+     * Not reentrant: call from one thread at a time, and not from inside a task.
+     */
+    void parallel_for(size_t num_tasks, const TaskFunction& fn);
+
+    /**
+     * @brief Resolve a user-facing thread count (0 or negative = hardware concurrency)
+     */
+    [[nodiscard]] static size_t resolve_thread_count(int requested);
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_; // One per worker (index 0 = caller)
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    const TaskFunction* job_ = nullptr;
+    size_t generation_ = 0;
+    size_t active_workers_ = 0;
+    bool stopping_ = false;
+
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void worker_loop(size_t worker);
+    void run_tasks(size_t worker, const TaskFunction& fn);
+    [[nodiscard]] bool pop_task(size_t worker, size_t& task);
+};
+
+} // namespace core
+} // namespace x3dna
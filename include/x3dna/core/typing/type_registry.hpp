@@ -7,7 +7,6 @@
 
 #include <string>
 #include <map>
-#include <set>
 #include <optional>
 #include <x3dna/core/typing/molecule_type.hpp>
 #include <x3dna/core/typing/nucleotide_type.hpp>
@@ -55,6 +54,12 @@ struct AminoAcidInfo {
  *
  * Replaces scattered type checks throughout the codebase with
  * a centralized, data-driven approach.
+ *
+ * Residue names are looked up in the perfect-hash tables generated from
+ * resources/config at build time (typing_tables_generated.hpp). Nucleotides
+ * are still loaded from modified_nucleotides.json at runtime; if that file
+ * differs from the one the tables were generated from, nucleotide
+ * classification falls back to the loaded registry.
  */
 class TypeRegistry {
 public:
@@ -101,6 +106,12 @@ public:
      */
     [[nodiscard]] bool is_nucleotide(const std::string& residue_name) const;
 
+    /**
+     * @brief Check if classify_residue() uses the generated nucleotide table
+     * @return false if the runtime modified_nucleotides.json differs from the generated one
+     */
+    [[nodiscard]] bool uses_nucleotide_table() const { return nucleotides_match_table_; }
+
     // === Nucleotide-specific lookups ===
 
     /**
@@ -152,14 +163,12 @@ private:
 
     void load_nucleotides();
     void load_amino_acids();
-    void load_waters();
-    void load_ions();
+    [[nodiscard]] bool nucleotides_match_table() const;
 
-    // Data storage
+    // Data storage; waters and ions are served from the generated tables alone
     std::map<std::string, NucleotideInfo> nucleotides_;
     std::map<std::string, AminoAcidInfo> amino_acids_;
-    std::set<std::string> water_names_;
-    std::map<std::string, IonType> ion_types_;
+    bool nucleotides_match_table_ = false;
 };
 
 } // namespace typing
@@ -0,0 +1,1180 @@
+/**
+ * @file typing_tables_generated.hpp
+ * @brief Auto-generated perfect-hash atom and residue typing tables
+ *
+ * Generated: 2026-10-16T03:28:24.663840
+ * Source: resources/config/standard_types.json, resources/config/modified_nucleotides.json
+ *
+ * DO NOT EDIT THIS FILE DIRECTLY!
+ * Edit the JSON files and rebuild (CMake runs generate_typing_tables.py automatically)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <x3dna/core/typing/atom_type.hpp>
+#include <x3dna/core/typing/nucleotide_type.hpp>
+#include <x3dna/core/typing/protein_type.hpp>
+#include <x3dna/core/typing/solvent_type.hpp>
+
+namespace x3dna {
+namespace core {
+namespace typing {
+namespace tables {
+
+/// Seeded FNV-1 hash shared by all tables (seed 0 selects the bucket)
+constexpr uint32_t name_hash(uint32_t seed, std::string_view name) {
+    uint32_t h = seed != 0 ? seed : 0x01000193u;
+    for (char c : name) {
+        h = (h * 0x01000193u) ^ static_cast<unsigned char>(c);
+    }
+    return h;
+}
+
+/// Slot of a name: the bucket seed either rehashes the name or names the slot directly
+template <size_t N>
+constexpr size_t perfect_hash_slot(const int32_t (&seeds)[N], std::string_view name) {
+    const int32_t seed = seeds[name_hash(0, name) % N];
+    return seed < 0 ? static_cast<size_t>(-seed - 1) : name_hash(static_cast<uint32_t>(seed), name) % N;
+}
+
+// Atom location flags
+constexpr uint8_t ATOM_BACKBONE = 1;
+constexpr uint8_t ATOM_SUGAR = 2;
+constexpr uint8_t ATOM_RING = 4;
+constexpr uint8_t ATOM_MAINCHAIN = 8;
+
+/// Atom types of one trimmed atom name, per molecule type
+struct AtomNameEntry {
+    std::string_view name;
+    AtomType nucleotide_type;
+    AtomType protein_type;
+    AtomType water_type;
+    uint8_t locations;
+};
+
+constexpr size_t ATOM_NAME_COUNT = 70;
+
+constexpr int32_t ATOM_NAME_SEEDS[ATOM_NAME_COUNT] = {
+    0, 0, 0, 0, 2, 0, 0, 1, -66, 0,
+    0, -65, -63, 0, 0, 0, 0, 0, -59, 0,
+    0, 0, 0, 0, 0, 1, -56, 0, -43, -39,
+    -34, 0, -30, -26, 1, 3, -22, 2, -20, -17,
+    4, -15, 5, -14, 1, 1, -11, -10, 2, 8,
+    2, 2, 0, 1, 11, 0, 0, 0, 5, 0,
+    -5, 5, 5, 11, 1, 20, -4, 0, 0, -2,
+};
+
+constexpr AtomNameEntry ATOM_NAMES[ATOM_NAME_COUNT] = {
+    {"CD1", AtomType::UNKNOWN, AtomType::CD1, AtomType::UNKNOWN, 0},
+    {"P", AtomType::P, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"O5'", AtomType::O5_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"ND1", AtomType::UNKNOWN, AtomType::ND1, AtomType::UNKNOWN, 0},
+    {"C6", AtomType::C6, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"OE2", AtomType::UNKNOWN, AtomType::OE2, AtomType::UNKNOWN, 0},
+    {"C", AtomType::UNKNOWN, AtomType::C, AtomType::UNKNOWN, ATOM_MAINCHAIN},
+    {"C1'", AtomType::C1_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"CB", AtomType::UNKNOWN, AtomType::CB, AtomType::UNKNOWN, 0},
+    {"CG2", AtomType::UNKNOWN, AtomType::CG2, AtomType::UNKNOWN, 0},
+    {"N1", AtomType::N1, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"NZ", AtomType::UNKNOWN, AtomType::NZ, AtomType::UNKNOWN, 0},
+    {"CD2", AtomType::UNKNOWN, AtomType::CD2, AtomType::UNKNOWN, 0},
+    {"N4", AtomType::N4, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"CE", AtomType::UNKNOWN, AtomType::CE, AtomType::UNKNOWN, 0},
+    {"CG1", AtomType::UNKNOWN, AtomType::CG1, AtomType::UNKNOWN, 0},
+    {"CG", AtomType::UNKNOWN, AtomType::CG, AtomType::UNKNOWN, 0},
+    {"C5M", AtomType::C5M, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"O2", AtomType::O2, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"OG1", AtomType::UNKNOWN, AtomType::OG1, AtomType::UNKNOWN, 0},
+    {"N2", AtomType::N2, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"OXT", AtomType::UNKNOWN, AtomType::OXT, AtomType::UNKNOWN, ATOM_MAINCHAIN},
+    {"O6", AtomType::O6, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"CA", AtomType::UNKNOWN, AtomType::CA, AtomType::UNKNOWN, ATOM_MAINCHAIN},
+    {"C4", AtomType::C4, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"OP3", AtomType::OP3, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"C3'", AtomType::C3_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"C7", AtomType::C7, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"CZ2", AtomType::UNKNOWN, AtomType::CZ2, AtomType::UNKNOWN, 0},
+    {"OP2", AtomType::OP2, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"N7", AtomType::N7, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"N6", AtomType::N6, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"C2'", AtomType::C2_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"SD", AtomType::UNKNOWN, AtomType::SD, AtomType::UNKNOWN, 0},
+    {"N", AtomType::UNKNOWN, AtomType::N, AtomType::UNKNOWN, ATOM_MAINCHAIN},
+    {"O", AtomType::UNKNOWN, AtomType::O, AtomType::OW, ATOM_MAINCHAIN},
+    {"C8", AtomType::C8, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"O1P", AtomType::OP1, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"SG", AtomType::UNKNOWN, AtomType::SG, AtomType::UNKNOWN, 0},
+    {"OG", AtomType::UNKNOWN, AtomType::OG, AtomType::UNKNOWN, 0},
+    {"C2", AtomType::C2, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"O3'", AtomType::O3_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"CH2", AtomType::UNKNOWN, AtomType::CH2, AtomType::UNKNOWN, 0},
+    {"N3", AtomType::N3, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"CE2", AtomType::UNKNOWN, AtomType::CE2, AtomType::UNKNOWN, 0},
+    {"CE3", AtomType::UNKNOWN, AtomType::CE3, AtomType::UNKNOWN, 0},
+    {"O4", AtomType::O4, AtomType::UNKNOWN, AtomType::UNKNOWN, 0},
+    {"CE1", AtomType::UNKNOWN, AtomType::CE1, AtomType::UNKNOWN, 0},
+    {"OD2", AtomType::UNKNOWN, AtomType::OD2, AtomType::UNKNOWN, 0},
+    {"C4'", AtomType::C4_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"N9", AtomType::N9, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"OP1", AtomType::OP1, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"OD1", AtomType::UNKNOWN, AtomType::OD1, AtomType::UNKNOWN, 0},
+    {"NH2", AtomType::UNKNOWN, AtomType::NH2, AtomType::UNKNOWN, 0},
+    {"NE", AtomType::UNKNOWN, AtomType::NE, AtomType::UNKNOWN, 0},
+    {"O2P", AtomType::OP2, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_BACKBONE},
+    {"C5'", AtomType::C5_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"C5", AtomType::C5, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_RING},
+    {"CZ", AtomType::UNKNOWN, AtomType::CZ, AtomType::UNKNOWN, 0},
+    {"O4'", AtomType::O4_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"OW", AtomType::UNKNOWN, AtomType::UNKNOWN, AtomType::OW, 0},
+    {"OE1", AtomType::UNKNOWN, AtomType::OE1, AtomType::UNKNOWN, 0},
+    {"NE2", AtomType::UNKNOWN, AtomType::NE2, AtomType::UNKNOWN, 0},
+    {"CZ3", AtomType::UNKNOWN, AtomType::CZ3, AtomType::UNKNOWN, 0},
+    {"NE1", AtomType::UNKNOWN, AtomType::NE1, AtomType::UNKNOWN, 0},
+    {"NH1", AtomType::UNKNOWN, AtomType::NH1, AtomType::UNKNOWN, 0},
+    {"OH", AtomType::UNKNOWN, AtomType::OH, AtomType::UNKNOWN, 0},
+    {"O2'", AtomType::O2_PRIME, AtomType::UNKNOWN, AtomType::UNKNOWN, ATOM_SUGAR},
+    {"ND2", AtomType::UNKNOWN, AtomType::ND2, AtomType::UNKNOWN, 0},
+    {"CD", AtomType::UNKNOWN, AtomType::CD, AtomType::UNKNOWN, 0},
+};
+
+/// Entry for an atom name, or nullptr if no table lists it
+constexpr const AtomNameEntry* find_atom_name(std::string_view name) {
+    const AtomNameEntry& entry = ATOM_NAMES[perfect_hash_slot(ATOM_NAME_SEEDS, name)];
+    return entry.name == name ? &entry : nullptr;
+}
+
+// Residue kind flags
+constexpr uint8_t RESIDUE_WATER = 1;
+constexpr uint8_t RESIDUE_NUCLEOTIDE = 2;
+constexpr uint8_t RESIDUE_AMINO_ACID = 4;
+constexpr uint8_t RESIDUE_ION = 8;
+
+/// Everything the typing JSON says about one residue name; fields of absent kinds are defaults
+struct ResidueNameEntry {
+    std::string_view name;
+    uint8_t kinds;
+    char nucleotide_code;
+    BaseType base_type;
+    bool is_purine;
+    char amino_acid_code;
+    AminoAcidType amino_acid_type;
+    AminoAcidCategory amino_acid_category;
+    IonType ion_type;
+};
+
+/// Number of names in modified_nucleotides.json
+constexpr size_t NUCLEOTIDE_COUNT = 421;
+
+constexpr size_t RESIDUE_NAME_COUNT = 472;
+
+constexpr int32_t RESIDUE_NAME_SEEDS[RESIDUE_NAME_COUNT] = {
+    1, -468, 1, 0, 0, 2, -466, -465, 1, -461,
+    1, 0, -460, 0, -458, 1, 1, 0, 0, 0,
+    1, 0, 0, 1, 0, 2, 0, -452, -450, 1,
+    -444, 0, 1, 1, -435, 1, -433, -428, 1, -427,
+    2, -421, -417, -415, 1, -414, -401, 0, -400, 0,
+    -397, -396, 1, 0, 0, -395, -392, 0, 0, 1,
+    3, 1, -382, 0, -379, 0, 4, 0, 4, -378,
+    1, 0, 0, 1, 0, 0, 2, 1, 1, -366,
+    0, 0, 0, 1, 1, 0, 6, 0, 0, -364,
+    0, 0, -362, 1, -348, 3, -346, 9, -345, -343,
+    -336, 0, -334, 0, 0, -332, 4, -321, 3, -316,
+    -315, 0, 1, 0, 0, 0, -312, 2, 0, 0,
+    -310, 0, 1, -305, 1, -304, 1, -303, 0, 3,
+    -297, 1, 2, -296, -294, 1, 1, 3, -291, 0,
+    -290, -289, 0, 10, 0, -284, 0, -282, -280, 0,
+    -278, 0, -276, 0, 0, 1, 0, 0, 0, 0,
+    0, 6, -275, -271, 3, 1, -270, 0, 7, -269,
+    -268, 0, 0, 0, -267, -266, 0, 0, 1, 0,
+    0, 0, 0, 1, 3, -264, 2, -258, 0, -257,
+    0, 0, 0, -256, 0, 2, -253, -250, 0, -244,
+    0, -238, 0, 0, -236, 2, 0, 1, 2, -233,
+    -232, -230, 0, -229, -226, 0, 0, 0, 0, 2,
+    0, 3, -222, 1, -221, 2, 0, 0, 2, 1,
+    3, 0, 0, 1, -220, -218, 0, 4, -217, 2,
+    0, 1, -216, 0, 0, 1, 0, -213, -212, 3,
+    3, 2, -209, -205, 0, 4, 5, -204, 0, 0,
+    0, -197, -196, 5, 2, 1, 0, 0, 0, 3,
+    -194, 0, 0, -192, -188, 1, 0, 2, 0, 0,
+    -187, -186, 0, -185, 2, -181, -180, 0, 0, 0,
+    0, 0, -179, -171, 0, 0, -170, -169, 0, 20,
+    0, 0, 0, 0, 0, 7, 1, -168, 0, 1,
+    11, -167, -162, 2, -160, 7, 1, 5, 0, 0,
+    -157, 4, 0, 0, 6, 4, 1, 0, -155, -153,
+    9, 0, 0, 0, 4, 0, 1, -152, 0, -150,
+    8, 0, 2, 9, 0, -146, -144, -138, 0, 0,
+    -137, 0, 5, -134, 0, 0, 4, 0, 0, 10,
+    0, 0, 0, 0, 0, 4, 0, -133, 2, 0,
+    5, -129, 0, -128, 3, 0, 1, -125, 10, 0,
+    -122, 0, 6, -117, 0, -113, -112, -110, 1, -108,
+    11, -101, 6, 0, -93, 2, -92, 0, -88, -81,
+    1, -71, 14, -70, 1, -69, 0, 4, 1, 0,
+    -57, 0, -46, 0, 2, 0, 0, -41, 0, 16,
+    5, -31, 0, 2, 0, 0, 1, 0, 0, 0,
+    2, -29, -28, 0, 7, 3, 1, 0, 27, 0,
+    0, 0, 0, -23, 0, 0, 0, 0, -21, 0,
+    -20, -15, -12, 0, -11, 0, 0, 0, 0, 14,
+    -10, 2, 0, 1, -9, 0, 0, 7, -6, 3,
+    -5, 0,
+};
+
+constexpr ResidueNameEntry RESIDUE_NAMES[RESIDUE_NAME_COUNT] = {
+    {"PLR", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NNR", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"FE", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::IRON},
+    {"A44", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UZL", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PHE", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'F', AminoAcidType::PHE, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"P5A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7DG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RY", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CCC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6HA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6HC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"12A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XGR", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GTA", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CO", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::COBALT},
+    {"RT", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CVC", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LHH", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OKQ", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6HG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"EEM", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RB", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::RUBIDIUM},
+    {"ANG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2TM", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"BGM", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"FMU", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DHU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XTR", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"VSN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"9QV", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LYS", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'K', AminoAcidType::LYS, AminoAcidCategory::POSITIVE, IonType::UNKNOWN},
+    {"ANP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"O2C", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GH3", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HYJ", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"1CC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G48", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PRO", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'P', AminoAcidType::PRO, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"YMP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ADE", RESIDUE_NUCLEOTIDE, 'A', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"URA", RESIDUE_NUCLEOTIDE, 'U', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ATD", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"B8N", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2MG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NI", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::NICKEL},
+    {"0DC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6GU", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M5M", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"BR", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::BROMIDE},
+    {"1RN", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2AU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0U", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TLN", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ILE", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'I', AminoAcidType::ILE, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"A23", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GDP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6OO", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GFL", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"EPE", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CH1", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"B8T", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"29H", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"56B", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CSL", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DI", RESIDUE_NUCLEOTIDE, 'I', BaseType::INOSINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0C", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DGP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LCA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LCG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GT3", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SAM", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"S4C", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"T2T", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TT", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"Q1V", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LEU", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'L', AminoAcidType::LEU, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"31M", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C5P", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N79", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"YG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ASP", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'D', AminoAcidType::ASP, AminoAcidCategory::NEGATIVE, IonType::UNKNOWN},
+    {"C5L", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RFJ", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DOC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ADP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5MU", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F7X", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AT7", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ONE", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"H2O", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ZJS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GLX", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'Z', AminoAcidType::GLX, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AMO", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UFB", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CFZ", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CDP", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F7R", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PSU", RESIDUE_NUCLEOTIDE, 'P', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"IMP", RESIDUE_NUCLEOTIDE, 'I', BaseType::INOSINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F7U", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HHX", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PGN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ADN", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"THY", RESIDUE_NUCLEOTIDE, 'T', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XAR", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GDO", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DDG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4OC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CPN", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A5M", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"V5A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RIA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"QSK", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UOA", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"45A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A5A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PQ0", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6MD", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"8OG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OMA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"JMH", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"84T", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MA6", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"574", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SSA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UD5", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"I6A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"75B", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PGP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6HT", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5BU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UR3", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DCT", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"B8H", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N6G", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GUN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HNG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"9SI", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2QB", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"WVQ", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"QUO", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6MZ", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RUS", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"E7X", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7S3", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C4J", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6F7", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MG", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::MAGNESIUM},
+    {"5FC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TTP", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ARG", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'R', AminoAcidType::ARG, AminoAcidCategory::POSITIVE, IonType::UNKNOWN},
+    {"1MA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UBB", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GRB", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DG", RESIDUE_NUCLEOTIDE, 'G', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TRP", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'W', AminoAcidType::TRP, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"P5P", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7RZ", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7SN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AF2", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GMP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OMU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DUT", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RVP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PQ1", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DT", RESIDUE_NUCLEOTIDE, 'T', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C2E", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4BW", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UNK", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'X', AminoAcidType::UNK, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DZ", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7MG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SFG", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4DU", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C43", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AMP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G5J", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6AP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"JSP", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"9YN", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OMC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A6C", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XLE", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'J', AminoAcidType::XLE, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"URI", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2IA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AR6", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G7M", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"W5Y", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AZA", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G2L", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2PR", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MUM", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PU", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OH2", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RSP", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"VAA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"OMG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GNP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XAN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ZTH", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M1Y", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ADS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DJF", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2MA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"8AZ", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NA", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::SODIUM},
+    {"3TD", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"1DP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GNG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G2P", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"QSI", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"J48", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ALA", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'A', AminoAcidType::ALA, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"IGU", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CL", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::CHLORIDE},
+    {"LI", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::LITHIUM},
+    {"CU", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::COPPER},
+    {"FYA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"IKS", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"US5", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GF2", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TSB", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"INO", RESIDUE_NUCLEOTIDE, 'I', BaseType::INOSINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PPS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UFP", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HOH", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5AD", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"L2B", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UOB", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PPU", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UFT", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"8RJ", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F6X", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UZR", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GLN", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'Q', AminoAcidType::GLN, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"6GO", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"23G", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LLP", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UCL", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XCR", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2KH", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ZN", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::ZINC},
+    {"Y5P", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PST", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SER", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'S', AminoAcidType::SER, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"HHU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M2G", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CSG", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G47", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UDP", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2BA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G46", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SSU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"H2U", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4SU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"141", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GLY", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'G', AminoAcidType::GLY, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"DG3", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"T5S", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"S4U", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N7X", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"BRU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3AD", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5CF", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SOL", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UY1", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"T6A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3AT", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CYS", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'C', AminoAcidType::CYS, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"A6A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U4M", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DU", RESIDUE_NUCLEOTIDE, 'U', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MET", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'M', AminoAcidType::MET, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"G4P", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"D3T", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XNY", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U33", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"US3", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U31", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A7C", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U36", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ASN", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'N', AminoAcidType::ASN, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"U23", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"APC", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GSU", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"APN", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DOD", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AT9", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0G", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CBV", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DA", RESIDUE_NUCLEOTIDE, 'A', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U5M", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TPN", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"IU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"1SC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"Q61", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HPA", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"BLS", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5IC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DTP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"29G", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GMX", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SUR", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"WSB", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"YYG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"T39", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"05H", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"16B", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MGT", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"73W", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TTD", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"I2T", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CMG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"HIS", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'H', AminoAcidType::HIS, AminoAcidCategory::POSITIVE, IonType::UNKNOWN},
+    {"CFL", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"RSQ", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TEP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MTU", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U5P", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AZG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7AT", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LV2", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6FC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6FU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"1W5", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GPN", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6MA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N6M", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UMO", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U5R", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MIA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GAP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TM2", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"FHU", RESIDUE_NUCLEOTIDE, 'p', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2DA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5CM", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2AD", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3AY", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GOM", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5FU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ASX", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'B', AminoAcidType::ASX, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2YR", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TYR", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'Y', AminoAcidType::TYR, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"9SY", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2RW", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CTP", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AVC", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CS", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::CESIUM},
+    {"XEC", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DZ4", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GAO", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LCC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SDG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"7OK", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"VC7", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UMS", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2MU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ANZ", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DSH", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"TG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F7O", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CA", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::CALCIUM},
+    {"THR", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'T', AminoAcidType::THR, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"P", RESIDUE_NUCLEOTIDE, 'P', BaseType::PSEUDOURIDINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ILA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M7G", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"URU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CD", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::CADMIUM},
+    {"DX4", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PRF", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NTT", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M7A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"EQ0", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"70U", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XUG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A7E", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LMS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3AU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4PC", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F73", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A6G", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CAR", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LSS", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5CG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XG4", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"WAT", RESIDUE_WATER, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GLU", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'E', AminoAcidType::GLU, AminoAcidCategory::NEGATIVE, IonType::UNKNOWN},
+    {"5AA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A2F", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0U1", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ZAN", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3DA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A2M", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SEC", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'U', AminoAcidType::SEC, AminoAcidCategory::POLAR, IonType::UNKNOWN},
+    {"A6U", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ZAD", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"8AN", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"3KA", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"LKC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"QSQ", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5HM", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"XMP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GUA", RESIDUE_NUCLEOTIDE, 'G', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NMN", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"AET", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MNU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C7R", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CYT", RESIDUE_NUCLEOTIDE, 'C', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6IA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NCU", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"U3H", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"NF2", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"4AC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5GS", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DC", RESIDUE_NUCLEOTIDE, 'C', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UTP", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"VRT", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5GP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"8B4", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5MC", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"UBD", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MG7", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2BP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ILK", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N5M", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CBR", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SR", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::STRONTIUM},
+    {"1MG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"T", RESIDUE_NUCLEOTIDE, 'T', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"ATP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"9DG", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PYL", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'O', AminoAcidType::PYL, AminoAcidCategory::POSITIVE, IonType::UNKNOWN},
+    {"MSP", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"F2A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GCP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"2SG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6GS", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"C", RESIDUE_NUCLEOTIDE, 'C', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"KIR", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"A", RESIDUE_NUCLEOTIDE, 'A', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"6NW", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MN", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::MANGANESE},
+    {"F", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::FLUORIDE},
+    {"F6U", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"VAL", RESIDUE_AMINO_ACID, '?', BaseType::UNKNOWN, false,
+     'V', AminoAcidType::VAL, AminoAcidCategory::HYDROPHOBIC, IonType::UNKNOWN},
+    {"K", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::POTASSIUM},
+    {"U", RESIDUE_NUCLEOTIDE, 'U', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"I", RESIDUE_NUCLEOTIDE, 'I', BaseType::INOSINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N5C", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"BA", RESIDUE_ION, '?', BaseType::UNKNOWN, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::BARIUM},
+    {"NCA", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MTA", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PUY", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"0DG", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"G", RESIDUE_NUCLEOTIDE, 'G', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"08T", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DCP", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"05K", RESIDUE_NUCLEOTIDE, 't', BaseType::THYMINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"SAH", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"CM0", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"PYO", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"N", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DCZ", RESIDUE_NUCLEOTIDE, 'c', BaseType::CYTOSINE, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"DGT", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"MGP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"5IU", RESIDUE_NUCLEOTIDE, 'u', BaseType::URACIL, false,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"M6A", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"GTP", RESIDUE_NUCLEOTIDE, 'g', BaseType::GUANINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+    {"365", RESIDUE_NUCLEOTIDE, 'a', BaseType::ADENINE, true,
+     '?', AminoAcidType::UNKNOWN, AminoAcidCategory::UNKNOWN, IonType::UNKNOWN},
+};
+
+/// Entry for a residue name, or nullptr if no table lists it
+constexpr const ResidueNameEntry* find_residue_name(std::string_view name) {
+    const ResidueNameEntry& entry = RESIDUE_NAMES[perfect_hash_slot(RESIDUE_NAME_SEEDS, name)];
+    return entry.name == name ? &entry : nullptr;
+}
+
+} // namespace tables
+} // namespace typing
+} // namespace core
+} // namespace x3dna
@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <cmath>
 #include <stdexcept>
@@ -50,6 +52,36 @@ public:
         }
     };
 
+    /// Capacity of a PointBlock (a base has at most nine ring atoms)
+    static constexpr size_t MAX_BLOCK_POINTS = 9;
+
+    /**
+     * @struct PointBlock
+     * @brief Matched point pairs of one fit, stored inline (no heap allocation)
+     */
+    struct PointBlock {
+        std::array<Vector3D, MAX_BLOCK_POINTS> points1; // Source points (standard/template)
+        std::array<Vector3D, MAX_BLOCK_POINTS> points2; // Target points (experimental)
+        size_t count = 0;
+
+        /**
+         * @brief Append one point pair
+         * @throws std::length_error if the block already holds MAX_BLOCK_POINTS pairs
+         */
+        void add(const Vector3D& p1, const Vector3D& p2) {
+            if (count == MAX_BLOCK_POINTS) {
+                throw std::length_error("PointBlock holds at most 9 point pairs");
+            }
+            points1[count] = p1;
+            points2[count] = p2;
+            ++count;
+        }
+
+        void clear() {
+            count = 0;
+        }
+    };
+
     /**
      * @brief Fit points1 to points2 using least squares
      * @param points1 Source points (standard/template)
@@ -66,10 +98,126 @@ public:
         }
 
         size_t n = points1.size();
+        Vector3D centroid1 = compute_centroid(points1.data(), n);
+        Vector3D centroid2 = compute_centroid(points2.data(), n);
+        Matrix3D cov = compute_covariance_matrix(points1.data(), points2.data(), n, centroid1, centroid2);
+        return solve(cov, centroid1, centroid2, points1.data(), points2.data(), n);
+    }
+
+    /**
+     * @brief Fit the point pairs of one block (same result as the vector overload)
+     * @throws std::invalid_argument if the block holds fewer than 3 pairs
+     */
+    FitResult fit(const PointBlock& block) {
+        if (block.count < 3) {
+            throw std::invalid_argument("Need at least 3 points for fitting");
+        }
+        const size_t n = block.count;
+        Vector3D centroid1 = compute_centroid(block.points1.data(), n);
+        Vector3D centroid2 = compute_centroid(block.points2.data(), n);
+        Matrix3D cov = compute_covariance_matrix(block.points1.data(), block.points2.data(), n, centroid1, centroid2);
+        return solve(cov, centroid1, centroid2, block.points1.data(), block.points2.data(), n);
+    }
+
+    /**
+     * @brief Fit many blocks at once
+     * @param blocks One block per fit
+     * @param results Receives blocks.size() results, in block order (existing capacity is reused)
+     * @throws std::invalid_argument if any block holds fewer than 3 pairs
+     *
+     * Centroids and covariances are accumulated for all blocks together, point
+     * slot by point slot, in loops over the blocks that the compiler can
+     * vectorize. Each result is bit-identical to fit(block). Scratch storage is
+     * kept in the fitter, so repeated calls on one fitter do not allocate once
+     * it has grown to the largest batch.
+     */
+    void fit_batch(const std::vector<PointBlock>& blocks, std::vector<FitResult>& results) {
+        const size_t n = blocks.size();
+        for (const auto& block : blocks) {
+            if (block.count < 3) {
+                throw std::invalid_argument("Need at least 3 points for fitting");
+            }
+        }
+        results.resize(n);
+        if (n == 0) {
+            return;
+        }
+
+        // Structure-of-arrays scratch: column c of slot k holds coordinate c of points[k] of every block
+        batch_scratch_.resize(n * BATCH_COLUMNS);
+        double* columns = batch_scratch_.data();
+        auto column = [columns, n](size_t c) { return columns + c * n; };
+
+        // Centroids: every block sums its points in order; unused slots add exactly zero
+        double* sum = column(COL_CENTROID);
+        std::fill(sum, sum + 6 * n, 0.0);
+        for (size_t k = 0; k < MAX_BLOCK_POINTS; ++k) {
+            for (size_t r = 0; r < n; ++r) {
+                const bool used = k < blocks[r].count;
+                const Vector3D& p1 = blocks[r].points1[k];
+                const Vector3D& p2 = blocks[r].points2[k];
+                sum[0 * n + r] += used ? p1.x() : 0.0;
+                sum[1 * n + r] += used ? p1.y() : 0.0;
+                sum[2 * n + r] += used ? p1.z() : 0.0;
+                sum[3 * n + r] += used ? p2.x() : 0.0;
+                sum[4 * n + r] += used ? p2.y() : 0.0;
+                sum[5 * n + r] += used ? p2.z() : 0.0;
+            }
+        }
+        for (size_t c = 0; c < 6; ++c) {
+            for (size_t r = 0; r < n; ++r) {
+                sum[c * n + r] /= static_cast<double>(blocks[r].count);
+            }
+        }
 
-        // Compute covariance matrix
-        Matrix3D cov = compute_covariance_matrix(points1, points2, n);
+        // Covariance: all nine products of a point pair in one pass over the slots
+        double* cov = column(COL_COVARIANCE);
+        std::fill(cov, cov + 9 * n, 0.0);
+        for (size_t k = 0; k < MAX_BLOCK_POINTS; ++k) {
+            for (size_t r = 0; r < n; ++r) {
+                const bool used = k < blocks[r].count;
+                const Vector3D& p1 = blocks[r].points1[k];
+                const Vector3D& p2 = blocks[r].points2[k];
+                const double d1[3] = {p1.x() - sum[0 * n + r], p1.y() - sum[1 * n + r], p1.z() - sum[2 * n + r]};
+                const double d2[3] = {p2.x() - sum[3 * n + r], p2.y() - sum[4 * n + r], p2.z() - sum[5 * n + r]};
+                for (size_t i = 0; i < 3; ++i) {
+                    for (size_t j = 0; j < 3; ++j) {
+                        cov[(3 * i + j) * n + r] += used ? d1[i] * d2[j] : 0.0;
+                    }
+                }
+            }
+        }
+
+        // Eigen-decomposition and RMS per block
+        for (size_t r = 0; r < n; ++r) {
+            const PointBlock& block = blocks[r];
+            const double divisor = static_cast<double>(block.count - 1);
+            Matrix3D U;
+            for (size_t ij = 0; ij < 9; ++ij) {
+                U.set(ij / 3, ij % 3, cov[ij * n + r] / divisor);
+            }
+            const Vector3D centroid1(sum[0 * n + r], sum[1 * n + r], sum[2 * n + r]);
+            const Vector3D centroid2(sum[3 * n + r], sum[4 * n + r], sum[5 * n + r]);
+            results[r] = solve(U, centroid1, centroid2, block.points1.data(), block.points2.data(), block.count);
+        }
+    }
 
+private:
+    // Helper types for 4x4 matrix and 4D vector
+    using Matrix4D = std::array<std::array<double, 4>, 4>;
+    using Vector4D = std::array<double, 4>;
+
+    // fit_batch scratch layout: six centroid columns, then nine covariance columns
+    static constexpr size_t COL_CENTROID = 0;
+    static constexpr size_t COL_COVARIANCE = 6;
+    static constexpr size_t BATCH_COLUMNS = 15;
+    std::vector<double> batch_scratch_;
+
+    /**
+     * @brief Rotation from the covariance matrix, then translation and RMS
+     */
+    FitResult solve(const Matrix3D& cov, const Vector3D& centroid1, const Vector3D& centroid2,
+                    const Vector3D* points1, const Vector3D* points2, size_t n) {
         // Build 4x4 quaternion matrix N
         Matrix4D N = build_quaternion_matrix(cov);
 
@@ -79,10 +227,6 @@ public:
         // Extract rotation matrix from quaternion
         Matrix3D rotation = quaternion_to_rotation_matrix(quaternion);
 
-        // Compute centroids
-        Vector3D centroid1 = compute_centroid(points1);
-        Vector3D centroid2 = compute_centroid(points2);
-
         // Compute translation: t = centroid2 - R * centroid1
         Vector3D translation = centroid2 - (rotation * centroid1);
 
@@ -92,47 +236,31 @@ public:
         return {rotation, translation, rms};
     }
 
-private:
-    // Helper types for 4x4 matrix and 4D vector
-    using Matrix4D = std::array<std::array<double, 4>, 4>;
-    using Vector4D = std::array<double, 4>;
-
     /**
      * @brief Compute covariance matrix between two point sets
+     *
+     * U = (1/(n-1)) * sum((p1 - c1) * (p2 - c2)^T), with each point's offsets
+     * computed once and all nine sums accumulated in the same pass.
      */
-    Matrix3D compute_covariance_matrix(const std::vector<Vector3D>& points1, const std::vector<Vector3D>& points2,
-                                       size_t n) {
-        // Compute centroids
-        Vector3D centroid1 = compute_centroid(points1);
-        Vector3D centroid2 = compute_centroid(points2);
+    Matrix3D compute_covariance_matrix(const Vector3D* points1, const Vector3D* points2, size_t n,
+                                       const Vector3D& centroid1, const Vector3D& centroid2) {
+        std::array<double, 9> sum{};
+        for (size_t k = 0; k < n; ++k) {
+            const Vector3D d1 = points1[k] - centroid1;
+            const Vector3D d2 = points2[k] - centroid2;
+            const double a[3] = {d1.x(), d1.y(), d1.z()};
+            const double b[3] = {d2.x(), d2.y(), d2.z()};
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    sum[3 * i + j] += a[i] * b[j];
+                }
+            }
+        }
 
-        // Compute covariance: U = (1/(n-1)) * sum((p1 - c1) * (p2 - c2)^T)
         Matrix3D cov;
         for (size_t i = 0; i < 3; ++i) {
             for (size_t j = 0; j < 3; ++j) {
-                double sum = 0.0;
-                for (size_t k = 0; k < n; ++k) {
-                    Vector3D d1 = points1[k] - centroid1;
-                    Vector3D d2 = points2[k] - centroid2;
-                    double d1_component;
-                    if (i == 0) {
-                        d1_component = d1.x();
-                    } else if (i == 1) {
-                        d1_component = d1.y();
-                    } else {
-                        d1_component = d1.z();
-                    }
-                    double d2_component;
-                    if (j == 0) {
-                        d2_component = d2.x();
-                    } else if (j == 1) {
-                        d2_component = d2.y();
-                    } else {
-                        d2_component = d2.z();
-                    }
-                    sum += d1_component * d2_component;
-                }
-                cov.set(i, j, sum / (n - 1));
+                cov.set(i, j, sum[3 * i + j] / (n - 1));
             }
         }
         return cov;
@@ -388,19 +516,19 @@ private:
     /**
      * @brief Compute centroid of point set
      */
-    Vector3D compute_centroid(const std::vector<Vector3D>& points) {
+    Vector3D compute_centroid(const Vector3D* points, size_t n) {
         Vector3D sum(0, 0, 0);
-        for (const auto& p : points) {
-            sum += p;
+        for (size_t i = 0; i < n; ++i) {
+            sum += points[i];
         }
-        return sum / static_cast<double>(points.size());
+        return sum / static_cast<double>(n);
     }
 
     /**
      * @brief Compute RMS between transformed points1 and points2
      */
-    double compute_rms(const std::vector<Vector3D>& points1, const std::vector<Vector3D>& points2,
-                       const Matrix3D& rotation, const Vector3D& translation, size_t n) {
+    double compute_rms(const Vector3D* points1, const Vector3D* points2, const Matrix3D& rotation,
+                       const Vector3D& translation, size_t n) {
         double sum_sq_diff = 0.0;
         for (size_t i = 0; i < n; ++i) {
             Vector3D transformed = rotation * points1[i] + translation;
@@ -0,0 +1,143 @@
+/**
+ * @file qcp_rmsd.hpp
+ * @brief RMSD after optimal superposition, without computing the superposition
+ *
+ * Quaternion characteristic polynomial method (Theobald 2005, with the
+ * coefficient form of Liu, Agrafiotis and Theobald 2010). The largest
+ * eigenvalue of the 4x4 key matrix is found by Newton iteration on its
+ * characteristic polynomial, starting from the upper bound E0; the rotation
+ * itself is never built. The minimum RMSD is the same quantity
+ * LeastSquaresFitter::fit reports, up to rounding.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "least_squares_fitter.hpp"
+#include "vector3d.hpp"
+
+namespace x3dna {
+namespace geometry {
+
+/**
+ * @brief Minimum RMSD between two matched point sets over all rotations and translations
+ * @param points1 First point set
+ * @param points2 Second point set (same order as points1)
+ * @param n Number of point pairs
+ * @return RMSD in the units of the input, or std::nullopt if n < 3
+ */
+[[nodiscard]] inline std::optional<double> superposition_rmsd(const Vector3D* points1, const Vector3D* points2,
+                                                              size_t n) noexcept {
+    if (n < 3) {
+        return std::nullopt;
+    }
+
+    // Centroids
+    double c1[3] = {0.0, 0.0, 0.0};
+    double c2[3] = {0.0, 0.0, 0.0};
+    for (size_t k = 0; k < n; ++k) {
+        c1[0] += points1[k].x(), c1[1] += points1[k].y(), c1[2] += points1[k].z();
+        c2[0] += points2[k].x(), c2[1] += points2[k].y(), c2[2] += points2[k].z();
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        c1[i] /= static_cast<double>(n);
+        c2[i] /= static_cast<double>(n);
+    }
+
+    // Inner product matrix S (S[3*i + j] = sum of centered a_i * b_j) and the squared norms
+    double S[9] = {};
+    double g1 = 0.0;
+    double g2 = 0.0;
+    for (size_t k = 0; k < n; ++k) {
+        const double a[3] = {points1[k].x() - c1[0], points1[k].y() - c1[1], points1[k].z() - c1[2]};
+        const double b[3] = {points2[k].x() - c2[0], points2[k].y() - c2[1], points2[k].z() - c2[2]};
+        g1 += a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+        g2 += b[0] * b[0] + b[1] * b[1] + b[2] * b[2];
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                S[3 * i + j] += a[i] * b[j];
+            }
+        }
+    }
+    const double e0 = 0.5 * (g1 + g2);
+
+    const double sxx = S[0], sxy = S[1], sxz = S[2];
+    const double syx = S[3], syy = S[4], syz = S[5];
+    const double szx = S[6], szy = S[7], szz = S[8];
+
+    const double sxx2 = sxx * sxx, syy2 = syy * syy, szz2 = szz * szz;
+    const double sxy2 = sxy * sxy, syz2 = syz * syz, sxz2 = sxz * sxz;
+    const double syx2 = syx * syx, szy2 = szy * szy, szx2 = szx * szx;
+
+    const double syz_szy_m_syy_szz2 = 2.0 * (syz * szy - syy * szz);
+    const double sxx2_syy2_szz2_syz2_szy2 = syy2 + szz2 - sxx2 + syz2 + szy2;
+
+    // Characteristic polynomial x^4 + c2 x^2 + c1 x + c0 of the key matrix
+    const double c2_coef = -2.0 * (sxx2 + syy2 + szz2 + sxy2 + syx2 + sxz2 + szx2 + syz2 + szy2);
+    const double c1_coef =
+        8.0 * (sxx * syz * szy + syy * szx * sxz + szz * sxy * syx - sxx * syy * szz - syz * szx * sxy - szy * syx * sxz);
+
+    const double sxz_p_szx = sxz + szx, syz_p_szy = syz + szy, sxy_p_syx = sxy + syx;
+    const double syz_m_szy = syz - szy, sxz_m_szx = sxz - szx, sxy_m_syx = sxy - syx;
+    const double sxx_p_syy = sxx + syy, sxx_m_syy = sxx - syy;
+    const double sxy2_sxz2_syx2_szx2 = sxy2 + sxz2 - syx2 - szx2;
+
+    const double c0_coef =
+        sxy2_sxz2_syx2_szx2 * sxy2_sxz2_syx2_szx2 +
+        (sxx2_syy2_szz2_syz2_szy2 + syz_szy_m_syy_szz2) * (sxx2_syy2_szz2_syz2_szy2 - syz_szy_m_syy_szz2) +
+        (-sxz_p_szx * syz_m_szy + sxy_m_syx * (sxx_m_syy - szz)) *
+            (-sxz_m_szx * syz_p_szy + sxy_m_syx * (sxx_m_syy + szz)) +
+        (-sxz_p_szx * syz_p_szy - sxy_p_syx * (sxx_p_syy - szz)) *
+            (-sxz_m_szx * syz_m_szy - sxy_p_syx * (sxx_p_syy + szz)) +
+        (sxy_p_syx * syz_p_szy + sxz_p_szx * (sxx_m_syy + szz)) *
+            (-sxy_m_syx * syz_m_szy + sxz_p_szx * (sxx_p_syy + szz)) +
+        (sxy_p_syx * syz_m_szy + sxz_m_szx * (sxx_m_syy - szz)) *
+            (-sxy_m_syx * syz_p_szy + sxz_m_szx * (sxx_p_syy - szz));
+
+    // Newton iteration from E0, which bounds the largest eigenvalue from above
+    constexpr double EVAL_PRECISION = 1e-11;
+    constexpr int MAX_NEWTON_STEPS = 50;
+    double lambda = e0;
+    for (int step = 0; step < MAX_NEWTON_STEPS; ++step) {
+        const double previous = lambda;
+        const double x2 = lambda * lambda;
+        const double b = (x2 + c2_coef) * lambda;
+        const double a = b + c1_coef;
+        const double denominator = 2.0 * x2 * lambda + b + a;
+        if (denominator == 0.0) {
+            break;
+        }
+        lambda -= (a * lambda + c0_coef) / denominator;
+        if (std::abs(lambda - previous) < std::abs(EVAL_PRECISION * lambda)) {
+            break;
+        }
+    }
+
+    // Rounding can leave E0 - lambda slightly negative for a perfect fit
+    return std::sqrt(std::abs(2.0 * (e0 - lambda) / static_cast<double>(n)));
+}
+
+/**
+ * @brief superposition_rmsd over two vectors
+ * @return std::nullopt if the sizes differ or fewer than 3 points are given
+ */
+[[nodiscard]] inline std::optional<double> superposition_rmsd(const std::vector<Vector3D>& points1,
+                                                              const std::vector<Vector3D>& points2) noexcept {
+    if (points1.size() != points2.size()) {
+        return std::nullopt;
+    }
+    return superposition_rmsd(points1.data(), points2.data(), points1.size());
+}
+
+/**
+ * @brief superposition_rmsd over the pairs of a fitter point block
+ */
+[[nodiscard]] inline std::optional<double> superposition_rmsd(const LeastSquaresFitter::PointBlock& block) noexcept {
+    return superposition_rmsd(block.points1.data(), block.points2.data(), block.count);
+}
+
+} // namespace geometry
+} // namespace x3dna
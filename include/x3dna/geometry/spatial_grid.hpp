@@ -0,0 +1,162 @@
+/**
+ * @file spatial_grid.hpp
+ * @brief Uniform cell list for fixed-radius neighbor queries over 3D points
+ *
+ * Points are bucketed into cubic cells whose edge is at least the query
+ * radius, so every point within that radius of a query point lies in the
+ * 3x3x3 block of cells around it. Storage is a flat counting-sort layout
+ * (cell offsets + point indices), built in O(N).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "vector3d.hpp"
+
+namespace x3dna {
+namespace geometry {
+
+/**
+ * @class SpatialGrid
+ * @brief Cell list returning candidate neighbors within a fixed radius
+ *
+ * Queries return a superset of the true neighbors (everything in the
+ * surrounding 27 cells); callers apply their own exact distance test so
+ * results are identical to a brute-force scan.
+ */
+class SpatialGrid {
+public:
+    /**
+     * @brief Build grid over points
+     * @param points Points to index (indices into this vector are returned by queries)
+     * @param radius Largest query radius that will be used (must be > 0)
+     */
+    SpatialGrid(const std::vector<Vector3D>& points, double radius) : num_points_(points.size()) {
+        build(points, radius);
+    }
+
+    /**
+     * @brief Collect indices of points in cells adjacent to the cell containing p
+     * @param p Query point
+     * @param out Output vector (cleared first); order is unspecified
+     */
+    void candidates_near(const Vector3D& p, std::vector<size_t>& out) const {
+        out.clear();
+        if (num_points_ == 0) {
+            return;
+        }
+        const long cx = cell_coord(p.x(), min_.x());
+        const long cy = cell_coord(p.y(), min_.y());
+        const long cz = cell_coord(p.z(), min_.z());
+
+        for (long z = std::max(cz - 1, 0L); z <= std::min(cz + 1, nz_ - 1); ++z) {
+            for (long y = std::max(cy - 1, 0L); y <= std::min(cy + 1, ny_ - 1); ++y) {
+                for (long x = std::max(cx - 1, 0L); x <= std::min(cx + 1, nx_ - 1); ++x) {
+                    const size_t cell = cell_index(x, y, z);
+                    out.insert(out.end(), items_.begin() + cell_start_[cell], items_.begin() + cell_start_[cell + 1]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Number of indexed points
+     */
+    [[nodiscard]] size_t size() const {
+        return num_points_;
+    }
+
+    /**
+     * @brief Number of cells in the grid
+     */
+    [[nodiscard]] size_t num_cells() const {
+        return cell_start_.empty() ? 0 : cell_start_.size() - 1;
+    }
+
+private:
+    // Cap on cells per point; sparse structures grow the cell edge instead of allocating empty cells
+    static constexpr size_t MAX_CELLS_PER_POINT = 8;
+
+    size_t num_points_ = 0;
+    Vector3D min_;
+    double inv_cell_ = 1.0;
+    long nx_ = 1, ny_ = 1, nz_ = 1;
+    std::vector<size_t> cell_start_;
+    std::vector<size_t> items_;
+
+    [[nodiscard]] long cell_coord(double value, double origin) const {
+        const long c = static_cast<long>(std::floor((value - origin) * inv_cell_));
+        return std::max(c, 0L);
+    }
+
+    [[nodiscard]] size_t cell_index(long x, long y, long z) const {
+        return static_cast<size_t>((z * ny_ + y) * nx_ + x);
+    }
+
+    [[nodiscard]] size_t cell_of(const Vector3D& p) const {
+        return cell_index(std::min(cell_coord(p.x(), min_.x()), nx_ - 1), std::min(cell_coord(p.y(), min_.y()), ny_ - 1),
+                          std::min(cell_coord(p.z(), min_.z()), nz_ - 1));
+    }
+
+    void build(const std::vector<Vector3D>& points, double radius) {
+        if (points.empty()) {
+            return;
+        }
+
+        Vector3D max = points.front();
+        min_ = points.front();
+        for (const auto& p : points) {
+            min_ = Vector3D(std::min(min_.x(), p.x()), std::min(min_.y(), p.y()), std::min(min_.z(), p.z()));
+            max = Vector3D(std::max(max.x(), p.x()), std::max(max.y(), p.y()), std::max(max.z(), p.z()));
+        }
+
+        // Slightly enlarge the cell so rounding can never separate two points
+        // within radius by more than one cell
+        const Vector3D extent = max - min_;
+        const double max_extent = std::max({extent.x(), extent.y(), extent.z()});
+        double cell = radius * (1.0 + 1e-9);
+        if (!std::isfinite(cell) || cell <= 0.0) {
+            // Degenerate radius: one cell holding everything (brute force)
+            cell = std::max(max_extent, 1.0) * 2.0;
+        }
+        const size_t max_cells = std::max<size_t>(1, points.size() * MAX_CELLS_PER_POINT);
+        auto dims_for = [&extent](double edge) {
+            return std::array<long, 3>{static_cast<long>(extent.x() / edge) + 1, static_cast<long>(extent.y() / edge) + 1,
+                                       static_cast<long>(extent.z() / edge) + 1};
+        };
+        auto dims = dims_for(cell);
+        while (static_cast<double>(dims[0]) * static_cast<double>(dims[1]) * static_cast<double>(dims[2]) >
+               static_cast<double>(max_cells)) {
+            cell *= 2.0;
+            dims = dims_for(cell);
+        }
+        nx_ = dims[0];
+        ny_ = dims[1];
+        nz_ = dims[2];
+        inv_cell_ = 1.0 / cell;
+
+        // Counting sort of point indices by cell
+        const size_t n_cells = static_cast<size_t>(nx_ * ny_ * nz_);
+        std::vector<size_t> point_cell(points.size());
+        cell_start_.assign(n_cells + 1, 0);
+        for (size_t i = 0; i < points.size(); ++i) {
+            point_cell[i] = cell_of(points[i]);
+            ++cell_start_[point_cell[i] + 1];
+        }
+        for (size_t c = 0; c < n_cells; ++c) {
+            cell_start_[c + 1] += cell_start_[c];
+        }
+        items_.resize(points.size());
+        std::vector<size_t> fill(cell_start_.begin(), cell_start_.end() - 1);
+        for (size_t i = 0; i < points.size(); ++i) {
+            items_[fill[point_cell[i]]++] = i;
+        }
+    }
+};
+
+} // namespace geometry
+} // namespace x3dna
@@ -36,6 +36,7 @@ struct AnalyzeConfig {
     size_t step_start = 1;           ///< Step start index (1-based, for -S option)
     size_t step_size = 1;            ///< Step size (1-based, for -S option)
     bool legacy_mode = false;        ///< Enable legacy compatibility mode
+    int num_threads = 1;             ///< Threads for frame calculation (0 = hardware concurrency)
 };
 
 /**
@@ -102,6 +103,13 @@ public:
         return config_.calculate_torsions;
     }
 
+    void set_num_threads(int value) {
+        config_.num_threads = value;
+    }
+    [[nodiscard]] int num_threads() const {
+        return config_.num_threads;
+    }
+
     void set_simple_parameters(bool value) {
         config_.simple_parameters = value;
     }
@@ -33,6 +33,7 @@ struct FindPairConfig {
     bool legacy_mode = false;         ///< Enable legacy compatibility mode
     std::filesystem::path output_dir; ///< Output directory for JSON files
     std::string output_stage = "all"; ///< Output stage: "frames", "distances", "hbonds", etc.
+    int num_threads = 1;              ///< Threads for frames and pair finding (0 = hardware concurrency)
 };
 
 /**
@@ -114,6 +115,13 @@ public:
         return config_.legacy_mode;
     }
 
+    void set_num_threads(int value) {
+        config_.num_threads = value;
+    }
+    [[nodiscard]] int num_threads() const {
+        return config_.num_threads;
+    }
+
     void set_output_dir(const std::filesystem::path& dir) {
         config_.output_dir = dir;
     }
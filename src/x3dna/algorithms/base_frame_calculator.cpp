@@ -6,8 +6,10 @@
 #include <x3dna/algorithms/base_frame_calculator.hpp>
 #include <x3dna/algorithms/validation_constants.hpp>
 #include <x3dna/core/nucleotide_utils.hpp>
+#include <x3dna/core/thread_pool.hpp>
 #include <x3dna/core/typing/type_registry.hpp>
 #include <x3dna/core/typing/atom_type.hpp>
+#include <x3dna/geometry/qcp_rmsd.hpp>
 #include <stdexcept>
 #include <cmath>
 #include <algorithm>
@@ -96,14 +98,12 @@ RmsdCheckResult check_nt_type_by_rmsd(const core::Residue& residue) {
         }
     }
 
-    // Perform least-squares fitting
-    geometry::LeastSquaresFitter fitter;
-    try {
-        auto fit_result = fitter.fit(standard_coords, experimental_coords);
-        return {fit_result.rms, purine_atom_count > 0, matched_names, experimental_coords, standard_coords};
-    } catch (const std::exception&) {
+    // Only the RMSD is needed, so skip building the fitted rotation
+    const auto rms = geometry::superposition_rmsd(standard_coords, experimental_coords);
+    if (!rms.has_value()) {
         return {std::nullopt, purine_atom_count > 0, {}, {}, {}};
     }
+    return {rms, purine_atom_count > 0, matched_names, experimental_coords, standard_coords};
 }
 
 // Known non-nucleotide molecules to exclude
@@ -206,31 +206,21 @@ core::typing::BaseType determine_pyrimidine_type(const core::Residue& residue, c
 
 // Try pyrimidine-only RMSD check using AtomType
 std::optional<double> try_pyrimidine_rmsd(const core::Residue& residue) {
-    std::vector<geometry::Vector3D> exp_coords;
-    std::vector<geometry::Vector3D> std_coords;
+    geometry::LeastSquaresFitter::PointBlock block;
 
     // Only check first 6 ring atoms (pyrimidine ring, excluding purine-only N7, C8, N9)
     for (size_t i = 0; i < 6; ++i) {
         AtomType target_type = RING_ATOM_TYPES[i];
         const core::Atom* atom = residue.find_atom_by_type(target_type);
         if (atom != nullptr) {
-            const auto& pos = atom->position();
-            exp_coords.push_back(geometry::Vector3D(pos.x(), pos.y(), pos.z()));
-            std_coords.push_back(geometry::Vector3D(STANDARD_RING_GEOMETRY[i][0], STANDARD_RING_GEOMETRY[i][1],
-                                                    STANDARD_RING_GEOMETRY[i][2]));
+            block.add(geometry::Vector3D(STANDARD_RING_GEOMETRY[i][0], STANDARD_RING_GEOMETRY[i][1],
+                                         STANDARD_RING_GEOMETRY[i][2]),
+                      atom->position());
         }
     }
 
-    if (exp_coords.size() < 3)
-        return std::nullopt;
-
-    geometry::LeastSquaresFitter fitter;
-    try {
-        auto result = fitter.fit(std_coords, exp_coords);
-        return result.rms;
-    } catch (const std::exception&) {
-        return std::nullopt;
-    }
+    // std::nullopt for fewer than 3 atoms
+    return geometry::superposition_rmsd(block);
 }
 
 // Check if residue needs special type detection
@@ -260,6 +250,27 @@ FrameCalculationResult BaseFrameCalculator::calculate_frame_const(const core::Re
 }
 
 FrameCalculationResult BaseFrameCalculator::calculate_frame_impl(const core::Residue& residue) const {
+    FrameCalculationResult result = match_frame_atoms(residue);
+    if (result.matched_standard_coords.empty()) {
+        return result;
+    }
+
+    // Perform least-squares fitting
+    geometry::LeastSquaresFitter fitter;
+    apply_fit(result, fitter.fit(result.matched_standard_coords, result.matched_experimental_coords));
+    return result;
+}
+
+void BaseFrameCalculator::apply_fit(FrameCalculationResult& result,
+                                    const geometry::LeastSquaresFitter::FitResult& fit_result) {
+    result.rotation_matrix = fit_result.rotation;
+    result.translation = fit_result.translation;
+    result.rms_fit = fit_result.rms;
+    result.frame = core::ReferenceFrame(result.rotation_matrix, result.translation);
+    result.is_valid = true;
+}
+
+FrameCalculationResult BaseFrameCalculator::match_frame_atoms(const core::Residue& residue) const {
     FrameCalculationResult result;
     result.is_valid = false;
 
@@ -339,15 +350,15 @@ FrameCalculationResult BaseFrameCalculator::calculate_frame_impl(const core::Res
         }
     }
 
-    // Load template
+    // Ring template: built once per base type, shared by reference
     bool is_modified = std::islower(static_cast<unsigned char>(one_letter));
-    core::Structure standard_template;
+    const RingTemplate* ring_template = nullptr;
     try {
-        standard_template = templates_.load_template(base_type, is_modified);
-        result.template_file = templates_.get_template_path(base_type, is_modified);
+        ring_template = &templates_.ring_template(base_type, is_modified);
     } catch (const std::exception&) {
         return result;
     }
+    result.template_file = ring_template->file;
 
     // Match ring atoms
     core::typing::BaseType matching_type = base_type;
@@ -355,60 +366,40 @@ FrameCalculationResult BaseFrameCalculator::calculate_frame_impl(const core::Res
         (base_type == core::typing::BaseType::ADENINE || base_type == core::typing::BaseType::GUANINE)) {
         matching_type = core::typing::BaseType::URACIL;
     }
-    MatchedAtoms matched = RingAtomMatcher::match(residue, standard_template,
-                                                  std::optional<core::typing::BaseType>(matching_type));
+    std::vector<std::string> atom_names;
+    std::vector<geometry::Vector3D> standard_coords;
+    std::vector<geometry::Vector3D> experimental_coords;
+    atom_names.reserve(core::typing::NUM_RING_ATOM_TYPES);
+    standard_coords.reserve(core::typing::NUM_RING_ATOM_TYPES);
+    experimental_coords.reserve(core::typing::NUM_RING_ATOM_TYPES);
+    size_t num_matched = RingAtomMatcher::match(residue, *ring_template, matching_type, atom_names, standard_coords,
+                                                experimental_coords);
 
     // Fallback to RMSD check atoms if template matching failed
-    if (!matched.is_valid() && has_ring_atoms && rmsd_result.has_value() && !rmsd_check.matched_atom_names.empty() &&
-        rmsd_check.matched_atom_names.size() >= 3) {
-        matched.num_matched = rmsd_check.matched_atom_names.size();
-        matched.atom_names = rmsd_check.matched_atom_names;
-        matched.experimental.clear();
-        matched.standard.clear();
-
-        for (size_t i = 0; i < rmsd_check.matched_atom_names.size(); ++i) {
-            const std::string& atom_name = rmsd_check.matched_atom_names[i];
+    if (num_matched < 3 && has_ring_atoms && rmsd_result.has_value() && rmsd_check.matched_atom_names.size() >= 3) {
+        atom_names = rmsd_check.matched_atom_names;
+        standard_coords = rmsd_check.matched_standard_coords;
+        experimental_coords.clear();
+        for (const auto& atom_name : rmsd_check.matched_atom_names) {
             for (const auto& atom : residue.atoms()) {
                 if (atom.name() == atom_name) {
-                    matched.experimental.push_back(atom);
+                    experimental_coords.push_back(atom.position());
                     break;
                 }
             }
-            const auto& std_coord = rmsd_check.matched_standard_coords[i];
-            core::Atom std_atom = core::Atom::create(atom_name, geometry::Vector3D(std_coord.x(), std_coord.y(), std_coord.z()))
-                                  .build();
-            matched.standard.push_back(std_atom);
         }
-
-        if (matched.experimental.size() < 3 || matched.standard.size() < 3) {
+        if (experimental_coords.size() != atom_names.size()) {
             return result;
         }
-    } else if (!matched.is_valid()) {
+        num_matched = atom_names.size();
+    } else if (num_matched < 3) {
         return result;
     }
 
-    result.num_matched = matched.num_matched;
-    result.matched_atoms = matched.atom_names;
-
-    // Extract coordinates
-    std::vector<geometry::Vector3D> standard_coords;
-    std::vector<geometry::Vector3D> experimental_coords;
-    for (size_t i = 0; i < matched.num_matched; ++i) {
-        standard_coords.push_back(matched.standard[i].position());
-        experimental_coords.push_back(matched.experimental[i].position());
-    }
-    result.matched_standard_coords = standard_coords;
-    result.matched_experimental_coords = experimental_coords;
-
-    // Perform least-squares fitting
-    geometry::LeastSquaresFitter fitter;
-    auto fit_result = fitter.fit(standard_coords, experimental_coords);
-
-    result.rotation_matrix = fit_result.rotation;
-    result.translation = fit_result.translation;
-    result.rms_fit = fit_result.rms;
-    result.frame = core::ReferenceFrame(result.rotation_matrix, result.translation);
-    result.is_valid = true;
+    result.num_matched = num_matched;
+    result.matched_atoms = std::move(atom_names);
+    result.matched_standard_coords = std::move(standard_coords);
+    result.matched_experimental_coords = std::move(experimental_coords);
 
     return result;
 }
@@ -416,15 +407,64 @@ FrameCalculationResult BaseFrameCalculator::calculate_frame_impl(const core::Res
 void BaseFrameCalculator::calculate_all_frames(core::Structure& structure) {
     std::vector<core::Residue*> residues;
     for (const auto* ptr : structure.residues_in_legacy_order()) {
-        residues.push_back(const_cast<core::Residue*>(ptr));
+        if (!ptr->is_protein()) {
+            residues.push_back(const_cast<core::Residue*>(ptr));
+        }
     }
 
-    for (auto* residue : residues) {
-        if (residue->is_protein()) {
+    // Match atoms (ring check, template lookup, atom matching) per residue. Each residue
+    // owns its result slot, so the outcome does not depend on the thread count.
+    const size_t n = residues.size();
+    std::vector<FrameCalculationResult> matched(n);
+    const size_t num_threads = core::ThreadPool::resolve_thread_count(num_threads_);
+    if (num_threads <= 1 || n < 2 * RESIDUES_PER_TASK) {
+        for (size_t i = 0; i < n; ++i) {
+            matched[i] = match_frame_atoms(*residues[i]);
+        }
+    } else {
+        const size_t num_tasks = (n + RESIDUES_PER_TASK - 1) / RESIDUES_PER_TASK;
+        core::ThreadPool pool(std::min(num_threads, num_tasks));
+        pool.parallel_for(num_tasks, [&](size_t task, size_t /* worker */) {
+            const size_t end = std::min(n, (task + 1) * RESIDUES_PER_TASK);
+            for (size_t i = task * RESIDUES_PER_TASK; i < end; ++i) {
+                matched[i] = match_frame_atoms(*residues[i]);
+            }
+        });
+    }
+
+    // Fit every base in one batch, then write frames back in legacy order
+    std::vector<size_t> fitted;
+    std::vector<geometry::LeastSquaresFitter::PointBlock> blocks;
+    geometry::LeastSquaresFitter fitter;
+
+    for (size_t i = 0; i < n; ++i) {
+        FrameCalculationResult& result = matched[i];
+        const size_t num_points = result.matched_standard_coords.size();
+        if (num_points == 0) {
+            continue;
+        }
+        if (num_points > geometry::LeastSquaresFitter::MAX_BLOCK_POINTS) {
+            apply_fit(result, fitter.fit(result.matched_standard_coords, result.matched_experimental_coords));
             continue;
         }
-        // Frame is stored in residue as side effect; result intentionally discarded
-        (void)calculate_frame(*residue);
+
+        auto& block = blocks.emplace_back();
+        for (size_t k = 0; k < num_points; ++k) {
+            block.add(result.matched_standard_coords[k], result.matched_experimental_coords[k]);
+        }
+        fitted.push_back(i);
+    }
+
+    std::vector<geometry::LeastSquaresFitter::FitResult> fits;
+    fitter.fit_batch(blocks, fits);
+    for (size_t b = 0; b < fitted.size(); ++b) {
+        apply_fit(matched[fitted[b]], fits[b]);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (matched[i].is_valid) {
+            residues[i]->set_reference_frame(matched[i].frame);
+        }
     }
 }
 
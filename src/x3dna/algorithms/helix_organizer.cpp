@@ -1218,18 +1218,6 @@ void HelixOrganizer::ensure_chain_order(const std::vector<core::BasePair>& pairs
         }
     }
 
-    // Helper to get residue pointer from structure by legacy index
-    auto get_residue_by_legacy_idx = [&structure](size_t legacy_idx) -> const core::Residue* {
-        for (const auto& chain : structure.chains()) {
-            for (const auto& residue : chain.residues()) {
-                if (static_cast<size_t>(residue.legacy_residue_idx()) == legacy_idx) {
-                    return &residue;
-                }
-            }
-        }
-        return nullptr;
-    };
-
     // Process each helix
     for (auto& helix : helices) {
         if (helix.start_idx > helix.end_idx) {
@@ -1250,8 +1238,8 @@ void HelixOrganizer::ensure_chain_order(const std::vector<core::BasePair>& pairs
             size_t res1_legacy = pair.residue_idx1() + 1;
             size_t res2_legacy = pair.residue_idx2() + 1;
 
-            const core::Residue* res1 = get_residue_by_legacy_idx(res1_legacy);
-            const core::Residue* res2 = get_residue_by_legacy_idx(res2_legacy);
+            const core::Residue* res1 = structure.get_residue_by_legacy_idx(static_cast<int>(res1_legacy));
+            const core::Residue* res2 = structure.get_residue_by_legacy_idx(static_cast<int>(res2_legacy));
 
             if (!res1 || !res2) {
                 if (debug) {
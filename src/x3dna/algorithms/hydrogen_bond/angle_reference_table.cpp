@@ -0,0 +1,33 @@
+/**
+ * @file angle_reference_table.cpp
+ * @brief Implementation of the per-residue angle reference table
+ */
+
+#include <x3dna/algorithms/hydrogen_bond/angle_reference_table.hpp>
+#include <x3dna/algorithms/hydrogen_bond/geometry.hpp>
+#include <string>
+
+namespace x3dna {
+namespace algorithms {
+namespace hydrogen_bond {
+
+AngleReferenceTable::AngleReferenceTable(const core::Residue& residue) : references_(residue.num_atoms(), NO_ATOM) {
+    const auto& atoms = residue.atoms();
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        const std::string reference_name = HBondGeometry::get_neighbor_atom_name(atoms[i].name());
+        if (reference_name.empty()) {
+            continue;
+        }
+        // First atom of that name, as Residue::find_atom would return
+        for (size_t k = 0; k < atoms.size(); ++k) {
+            if (atoms[k].name() == reference_name) {
+                references_[i] = static_cast<uint32_t>(k);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace hydrogen_bond
+} // namespace algorithms
+} // namespace x3dna
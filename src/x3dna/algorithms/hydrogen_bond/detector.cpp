@@ -13,13 +13,16 @@
 #include <x3dna/core/typing/atom_classification.hpp>
 #include <x3dna/core/typing/nucleotide_type.hpp>
 #include <x3dna/core/structure.hpp>
+#include <x3dna/core/thread_pool.hpp>
+#include <x3dna/geometry/spatial_grid.hpp>
 #include <x3dna/geometry/vector3d.hpp>
 #include <algorithm>
 #include <cmath>
-#include <map>
+#include <cstdint>
 #include <numeric>
+#include <optional>
 #include <set>
-#include <unordered_map>
+#include <tuple>
 
 namespace x3dna {
 namespace algorithms {
@@ -79,6 +82,39 @@ namespace {
     return false;
 }
 
+/**
+ * @brief Inclusive distance range tested on squared distances first
+ *
+ * The squared bounds are widened slightly, so only pairs near the range take
+ * a sqrt. The exact test is then on the same distance value as
+ * Vector3D::length(), so results match a plain distance compare.
+ */
+class DistanceRange {
+public:
+    DistanceRange(double min_dist, double max_dist)
+        : min_(min_dist), max_(max_dist), min_sq_(min_dist > 0.0 ? min_dist * min_dist * (1.0 - SLACK) : -1.0),
+          max_sq_(max_dist * max_dist * (1.0 + SLACK)) {}
+
+    /**
+     * @brief Check a pair of positions, setting dist when it is in range
+     */
+    [[nodiscard]] bool contains(const Vector3D& p1, const Vector3D& p2, double& dist) const {
+        const double dist_sq = (p1 - p2).length_squared();
+        if (dist_sq > max_sq_ || dist_sq < min_sq_) {
+            return false;
+        }
+        dist = std::sqrt(dist_sq);
+        return dist >= min_ && dist <= max_;
+    }
+
+private:
+    static constexpr double SLACK = 1e-9;
+    double min_;
+    double max_;
+    double min_sq_;
+    double max_sq_;
+};
+
 /**
  * @brief Convert HBondContext to HBondInteractionType for filtering
  */
@@ -223,9 +259,130 @@ char determine_base_type_from_atoms(const Residue& residue) {
     return '?';
 }
 
+/**
+ * @brief Candidate H-bond between two indexed polar atoms, if elements, context and distance allow one
+ * @param any_context Distance window over all contexts; the context-specific limit is applied here
+ */
+[[nodiscard]] std::optional<HBond> make_candidate_bond(const HBondDetectionParams& params,
+                                                       const DistanceRange& any_context, const Atom& atom1,
+                                                       const HBondAtomIndex::PolarAtom& p1, const Atom& atom2,
+                                                       const HBondAtomIndex::PolarAtom& p2, bool base_atoms_only,
+                                                       MoleculeType mol1_type, MoleculeType mol2_type) {
+    // Check if atoms can form H-bond based on elements (good_hb_atoms on the indexed flags)
+    if (!params.include_backbone_backbone && p1.po_list && p2.po_list) {
+        return std::nullopt;
+    }
+    if (!p1.is_o_or_n && !p2.is_o_or_n) {
+        return std::nullopt;
+    }
+
+    // Skip non-base atoms if requested (for nucleic acid base-base detection)
+    if (base_atoms_only && (!p1.nucleobase || !p2.nucleobase)) {
+        return std::nullopt;
+    }
+
+    double dist = 0.0;
+    if (!any_context.contains(atom1.position(), atom2.position(), dist)) {
+        return std::nullopt;
+    }
+
+    // Determine context for distance threshold
+    const HBondContext context = HBondGeometry::determine_context(atom1.name(), atom2.name(), mol1_type, mol2_type);
+
+    // Check interaction type filter
+    if (!passes_interaction_filter(context, params.interaction_filter)) {
+        return std::nullopt;
+    }
+
+    const double max_dist = params.distances.max_for_context(context);
+
+    // Check distance is in valid range
+    if (dist < params.distances.min_distance || dist > max_dist) {
+        return std::nullopt;
+    }
+
+    HBond hbond;
+    hbond.donor_atom_name = atom1.name();
+    hbond.acceptor_atom_name = atom2.name();
+    hbond.donor_atom_idx = p1.atom_idx;
+    hbond.acceptor_atom_idx = p2.atom_idx;
+    hbond.distance = dist;
+    hbond.context = context;
+    hbond.classification = HBondClassification::UNKNOWN;
+    hbond.conflict_state = ConflictState::NO_CONFLICT;
+    return hbond;
+}
+
+[[nodiscard]] MoleculeType molecule_type_of(const Residue& residue) {
+    return residue.is_nucleotide() ? MoleculeType::NUCLEIC_ACID
+         : residue.is_protein()    ? MoleculeType::PROTEIN
+                                   : MoleculeType::LIGAND;
+}
+
+/**
+ * @brief Two polar atoms of different residues within the widest context distance
+ *
+ * Residue indices come first so sorting groups atom pairs by residue pair, and
+ * polar indices follow atom order, so each group sorts into the order of
+ * find_candidate_bonds' nested scan.
+ */
+struct PolarAtomPair {
+    uint32_t residue_i;
+    uint32_t residue_j;
+    uint32_t polar_i;
+    uint32_t polar_j;
+
+    [[nodiscard]] bool operator<(const PolarAtomPair& other) const {
+        return std::tie(residue_i, residue_j, polar_i, polar_j) <
+               std::tie(other.residue_i, other.residue_j, other.polar_i, other.polar_j);
+    }
+
+    [[nodiscard]] bool same_residues(const PolarAtomPair& other) const {
+        return residue_i == other.residue_i && residue_j == other.residue_j;
+    }
+};
+
 } // namespace
 
-HBondDetector::HBondDetector(const HBondDetectionParams& params) : params_(params) {}
+HBondDetector::HBondDetector(const HBondDetectionParams& params)
+    : params_(params), allowed_element_indices_(parse_hb_atom_indices(params.allowed_elements)) {
+    const auto& d = params_.distances;
+    max_context_distance_ = std::max({d.base_base_max, d.base_backbone_max, d.backbone_backbone_max,
+                                      d.base_sugar_max, d.sugar_sugar_max, d.protein_mainchain_max,
+                                      d.protein_sidechain_max, d.base_protein_max, d.protein_ligand_max,
+                                      d.base_ligand_max});
+}
+
+HBondAtomIndex HBondDetector::index_atoms(const Residue& residue) const {
+    HBondAtomIndex index;
+    const auto& atoms = residue.atoms();
+    index.num_atoms = atoms.size();
+
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        const auto& atom = atoms[i];
+        if (atom.is_o2_prime()) {
+            index.o2_prime_atoms.push_back(i);
+        }
+
+        // good_hb_atoms requires both elements in the allowed list
+        const int element = AtomListUtils::get_atom_idx(atom.name());
+        if (std::find(allowed_element_indices_.begin(), allowed_element_indices_.end(), element) ==
+            allowed_element_indices_.end()) {
+            continue;
+        }
+
+        HBondAtomIndex::PolarAtom polar;
+        polar.atom_idx = i;
+        polar.is_o_or_n = (element == 2 || element == 4);
+        polar.legacy_base = is_base_atom(atom.name());
+        polar.nucleobase = AtomClassifier::is_nucleobase_atom(atom.name());
+        polar.o2_prime = atom.is_o2_prime();
+        polar.po_list = is_po_list_atom(atom.name());
+        index.polar_atoms.push_back(polar);
+    }
+
+    return index;
+}
 
 std::vector<HBond> HBondDetector::detect_base_hbonds(const Residue& residue1, const Residue& residue2) const {
     auto result = detect_base_hbonds_detailed(residue1, residue2);
@@ -234,7 +391,8 @@ std::vector<HBond> HBondDetector::detect_base_hbonds(const Residue& residue1, co
 
 HBondPipelineResult HBondDetector::detect_base_hbonds_detailed(const Residue& residue1,
                                                                const Residue& residue2) const {
-    return detect_internal(residue1, residue2, true, MoleculeType::NUCLEIC_ACID, MoleculeType::NUCLEIC_ACID);
+    return detect_internal(residue1, index_atoms(residue1), residue2, index_atoms(residue2), true,
+                           MoleculeType::NUCLEIC_ACID, MoleculeType::NUCLEIC_ACID, true);
 }
 
 std::vector<HBond> HBondDetector::detect_all_hbonds_between(const Residue& residue1, const Residue& residue2,
@@ -245,17 +403,42 @@ std::vector<HBond> HBondDetector::detect_all_hbonds_between(const Residue& resid
 
 HBondPipelineResult HBondDetector::detect_all_hbonds_detailed(const Residue& residue1, const Residue& residue2,
                                                               MoleculeType mol1_type, MoleculeType mol2_type) const {
-    return detect_internal(residue1, residue2, false, mol1_type, mol2_type);
+    return detect_internal(residue1, index_atoms(residue1), residue2, index_atoms(residue2), false, mol1_type,
+                           mol2_type, true);
 }
 
-HBondPipelineResult HBondDetector::detect_internal(const Residue& residue1, const Residue& residue2,
+HBondPipelineResult HBondDetector::detect_all_hbonds_detailed(const Residue& residue1, const HBondAtomIndex& index1,
+                                                              const Residue& residue2, const HBondAtomIndex& index2,
+                                                              MoleculeType mol1_type, MoleculeType mol2_type) const {
+    return detect_internal(residue1, index1, residue2, index2, false, mol1_type, mol2_type, true);
+}
+
+HBondPipelineResult HBondDetector::classify_all_hbonds(const Residue& residue1, const HBondAtomIndex& index1,
+                                                       const Residue& residue2, const HBondAtomIndex& index2,
+                                                       MoleculeType mol1_type, MoleculeType mol2_type) const {
+    return detect_internal(residue1, index1, residue2, index2, false, mol1_type, mol2_type, false);
+}
+
+HBondPipelineResult HBondDetector::detect_internal(const Residue& residue1, const HBondAtomIndex& index1,
+                                                    const Residue& residue2, const HBondAtomIndex& index2,
                                                     bool base_atoms_only, MoleculeType mol1_type,
-                                                    MoleculeType mol2_type) const {
+                                                    MoleculeType mol2_type, bool with_geometry) const {
+    // Step 1: Find candidate bonds
+    return process_candidates(
+        find_candidate_bonds(residue1, index1, residue2, index2, base_atoms_only, mol1_type, mol2_type), residue1,
+        residue2, mol1_type, mol2_type, with_geometry);
+}
+
+HBondPipelineResult HBondDetector::process_candidates(std::vector<HBond> candidates, const Residue& residue1,
+                                                      const Residue& residue2, MoleculeType mol1_type,
+                                                      MoleculeType mol2_type, bool with_geometry,
+                                                      const AngleReferenceTable* references1,
+                                                      const AngleReferenceTable* references2) const {
     HBondPipelineResult result;
 
-    // Step 1: Find candidate bonds - work in place using all_classified_bonds as working vector
+    // Work in place using all_classified_bonds as working vector
     auto& bonds = result.all_classified_bonds;
-    bonds = find_candidate_bonds(residue1, residue2, base_atoms_only, mol1_type, mol2_type);
+    bonds = std::move(candidates);
 
     if (bonds.empty()) {
         return result;
@@ -275,17 +458,27 @@ HBondPipelineResult HBondDetector::detect_internal(const Residue& residue1, cons
     }
 
     // Step 4: Classify bonds (in place)
-    classify_bonds(bonds, base1, base2);
+    classify_bonds(bonds, residue1, base1, residue2, base2);
+
+    // Steps 4b and 5 only describe bonds; they change no classification unless
+    // angle filtering or quality scoring reads the angles
+    if (with_geometry || params_.enable_angle_filtering || params_.enable_quality_scoring) {
+        // Step 4b: Classify Leontis-Westhof edges for each H-bond
+        const auto& atoms1 = residue1.atoms();
+        const auto& atoms2 = residue2.atoms();
+        for (auto& bond : bonds) {
+            bond.donor_edge = bond.donor_atom_idx < atoms1.size()
+                                  ? EdgeClassifier::classify(atoms1[bond.donor_atom_idx], base1)
+                                  : EdgeClassifier::classify(bond.donor_atom_name, base1);
+            bond.acceptor_edge = bond.acceptor_atom_idx < atoms2.size()
+                                     ? EdgeClassifier::classify(atoms2[bond.acceptor_atom_idx], base2)
+                                     : EdgeClassifier::classify(bond.acceptor_atom_name, base2);
+        }
 
-    // Step 4b: Classify Leontis-Westhof edges for each H-bond
-    for (auto& bond : bonds) {
-        bond.donor_edge = EdgeClassifier::classify(bond.donor_atom_name, base1);
-        bond.acceptor_edge = EdgeClassifier::classify(bond.acceptor_atom_name, base2);
+        // Step 5: Calculate angles for all bonds (in place)
+        calculate_angles(bonds, residue1, references1, residue2, references2);
     }
 
-    // Step 5: Calculate angles for all bonds (in place)
-    calculate_angles(bonds, residue1, residue2);
-
     // Step 6: Apply post-validation filtering (marks bonds as INVALID but doesn't remove)
     apply_post_validation_filtering(bonds);
 
@@ -322,35 +515,50 @@ HBondPipelineResult HBondDetector::detect_internal(const Residue& residue1, cons
 
 void HBondDetector::count_potential_hbonds(const Residue& res1, const Residue& res2, int& num_base_hb,
                                            int& num_o2_hb) const {
+    count_potential_hbonds(res1, index_atoms(res1), res2, index_atoms(res2), num_base_hb, num_o2_hb);
+}
+
+void HBondDetector::count_potential_hbonds(const Residue& res1, const HBondAtomIndex& index1, const Residue& res2,
+                                           const HBondAtomIndex& index2, int& num_base_hb, int& num_o2_hb) const {
     num_base_hb = 0;
     num_o2_hb = 0;
 
-    const double hb_lower = params_.distances.min_distance;
-    const double hb_dist1 = params_.distances.base_base_max;
-
-    for (const auto& a1 : res1.atoms()) {
-        for (const auto& a2 : res2.atoms()) {
-            const double dist = (a1.position() - a2.position()).length();
+    const auto& atoms1 = res1.atoms();
+    const auto& atoms2 = res2.atoms();
+    const DistanceRange range(params_.distances.min_distance, params_.distances.base_base_max);
+    double dist = 0.0;
 
-            if (dist < hb_lower || dist > hb_dist1) {
+    // Base-base: legacy is_base_atom on both sides, neither O2', and good_hb_atoms.
+    // Atoms outside the index fail good_hb_atoms on their element.
+    for (const auto& p1 : index1.polar_atoms) {
+        if (!p1.legacy_base || p1.o2_prime) {
+            continue;
+        }
+        for (const auto& p2 : index2.polar_atoms) {
+            if (!p2.legacy_base || p2.o2_prime) {
                 continue;
             }
-
-            // Use legacy is_base_atom logic for pair validation counting
-            const bool atom1_is_base = is_base_atom(a1.name());
-            const bool atom2_is_base = is_base_atom(a2.name());
-            const bool both_base = atom1_is_base && atom2_is_base;
-            // Use AtomType for O2' check (O(1) comparison)
-            const bool not_o2prime = !a1.is_o2_prime() && !a2.is_o2_prime();
-
-            if (both_base && not_o2prime) {
-                if (good_hb_atoms(a1.name(), a2.name(), params_.allowed_elements)) {
-                    num_base_hb++;
-                }
+            // good_hb_atoms: not both in the PO list, at least one O or N
+            if ((p1.po_list && p2.po_list) || (!p1.is_o_or_n && !p2.is_o_or_n)) {
+                continue;
             }
+            if (range.contains(atoms1[p1.atom_idx].position(), atoms2[p2.atom_idx].position(), dist)) {
+                num_base_hb++;
+            }
+        }
+    }
 
-            // Use AtomType for O2' check
-            if (a1.is_o2_prime() || a2.is_o2_prime()) {
+    // O2': any atom pair with an O2' on either side, each pair counted once
+    for (size_t i : index1.o2_prime_atoms) {
+        for (const auto& a2 : atoms2) {
+            if (range.contains(atoms1[i].position(), a2.position(), dist)) {
+                num_o2_hb++;
+            }
+        }
+    }
+    for (size_t j : index2.o2_prime_atoms) {
+        for (const auto& a1 : atoms1) {
+            if (!a1.is_o2_prime() && range.contains(a1.position(), atoms2[j].position(), dist)) {
                 num_o2_hb++;
             }
         }
@@ -401,8 +609,8 @@ std::vector<HBond> HBondDetector::detect_intra_residue_hbonds(
             hbond.context = context;
             hbond.classification = HBondClassification::UNKNOWN;
             hbond.conflict_state = ConflictState::NO_CONFLICT;
-            hbond.donor_res_id = residue.res_id();
-            hbond.acceptor_res_id = residue.res_id();  // Same residue
+            hbond.donor_atom_idx = i;
+            hbond.acceptor_atom_idx = j; // Same residue
 
             // Classify the bond
             char base_type = '?';
@@ -411,8 +619,8 @@ std::vector<HBond> HBondDetector::detect_intra_residue_hbonds(
             }
 
             // Get atom roles and classify
-            HBondAtomRole role1 = HBondRoleClassifier::get_nucleotide_atom_role(base_type, atom1.name());
-            HBondAtomRole role2 = HBondRoleClassifier::get_nucleotide_atom_role(base_type, atom2.name());
+            HBondAtomRole role1 = HBondRoleClassifier::get_nucleotide_atom_role(base_type, atom1);
+            HBondAtomRole role2 = HBondRoleClassifier::get_nucleotide_atom_role(base_type, atom2);
 
             // Check for AA/DD (unlikely chemistry)
             const bool is_aa = (role1 == HBondAtomRole::ACCEPTOR && role2 == HBondAtomRole::ACCEPTOR);
@@ -428,8 +636,8 @@ std::vector<HBond> HBondDetector::detect_intra_residue_hbonds(
             }
 
             // Set Leontis-Westhof edges
-            hbond.donor_edge = EdgeClassifier::classify(atom1.name(), base_type);
-            hbond.acceptor_edge = EdgeClassifier::classify(atom2.name(), base_type);
+            hbond.donor_edge = EdgeClassifier::classify(atom1, base_type);
+            hbond.acceptor_edge = EdgeClassifier::classify(atom2, base_type);
 
             bonds.push_back(hbond);
         }
@@ -438,57 +646,27 @@ std::vector<HBond> HBondDetector::detect_intra_residue_hbonds(
     return bonds;
 }
 
-std::vector<HBond> HBondDetector::find_candidate_bonds(const Residue& residue1, const Residue& residue2,
+std::vector<HBond> HBondDetector::find_candidate_bonds(const Residue& residue1, const HBondAtomIndex& index1,
+                                                        const Residue& residue2, const HBondAtomIndex& index2,
                                                         bool base_atoms_only, MoleculeType mol1_type,
                                                         MoleculeType mol2_type) const {
     std::vector<HBond> candidates;
 
-    for (const auto& atom1 : residue1.atoms()) {
-        for (const auto& atom2 : residue2.atoms()) {
-            // Check if atoms can form H-bond based on elements
-            if (!good_hb_atoms(atom1.name(), atom2.name(), params_.allowed_elements,
-                               params_.include_backbone_backbone)) {
-                continue;
-            }
-
-            // Skip non-base atoms if requested (for nucleic acid base-base detection)
-            if (base_atoms_only) {
-                const bool atom1_is_base = AtomClassifier::is_nucleobase_atom(atom1.name());
-                const bool atom2_is_base = AtomClassifier::is_nucleobase_atom(atom2.name());
-                if (!atom1_is_base || !atom2_is_base) {
-                    continue;
-                }
-            }
-
-            // Calculate distance
-            const double dist = (atom1.position() - atom2.position()).length();
+    const auto& atoms1 = residue1.atoms();
+    const auto& atoms2 = residue2.atoms();
 
-            // Determine context for distance threshold
-            const HBondContext context = HBondGeometry::determine_context(atom1.name(), atom2.name(), mol1_type,
-                                                                           mol2_type);
+    // Widest window over all contexts; the context-specific limit is applied per pair
+    const DistanceRange any_context(params_.distances.min_distance, max_context_distance_);
 
-            // Check interaction type filter
-            if (!passes_interaction_filter(context, params_.interaction_filter)) {
-                continue;
+    // Index order is atom order, so candidates come out in the same order as a full atom scan
+    for (const auto& p1 : index1.polar_atoms) {
+        const auto& atom1 = atoms1[p1.atom_idx];
+        for (const auto& p2 : index2.polar_atoms) {
+            auto hbond = make_candidate_bond(params_, any_context, atom1, p1, atoms2[p2.atom_idx], p2,
+                                             base_atoms_only, mol1_type, mol2_type);
+            if (hbond) {
+                candidates.push_back(std::move(*hbond));
             }
-
-            const double max_dist = params_.distances.max_for_context(context);
-
-            // Check distance is in valid range
-            if (dist < params_.distances.min_distance || dist > max_dist) {
-                continue;
-            }
-
-            // Create H-bond
-            HBond hbond;
-            hbond.donor_atom_name = atom1.name();
-            hbond.acceptor_atom_name = atom2.name();
-            hbond.distance = dist;
-            hbond.context = context;
-            hbond.classification = HBondClassification::UNKNOWN;
-            hbond.conflict_state = ConflictState::NO_CONFLICT;
-
-            candidates.push_back(hbond);
         }
     }
 
@@ -582,7 +760,11 @@ void HBondDetector::resolve_conflicts_phase3(std::vector<HBond>& bonds) const {
     (void)bonds; // Suppress unused parameter warning - logic is in classify_bonds
 }
 
-void HBondDetector::classify_bonds(std::vector<HBond>& bonds, char base1_type, char base2_type) const {
+void HBondDetector::classify_bonds(std::vector<HBond>& bonds, const Residue& residue1, char base1_type,
+                                   const Residue& residue2, char base2_type) const {
+    const auto& atoms1 = residue1.atoms();
+    const auto& atoms2 = residue2.atoms();
+
     // Legacy behavior: classify bonds that either:
     // 1. Are conflict winners (IS_CONFLICT_WINNER), OR
     // 2. Are in the extended distance range [hb_lower, hb_dist2] (Phase 3 promoted bonds)
@@ -611,17 +793,26 @@ void HBondDetector::classify_bonds(std::vector<HBond>& bonds, char base1_type, c
             continue;
         }
 
-        // Use legacy classification for nucleotide base-base (matches baseline exactly)
-        char legacy_type = BasePairValidator::donor_acceptor(
-            base1_type, base2_type, bond.donor_atom_name, bond.acceptor_atom_name);
+        // Use legacy classification for nucleotide base-base (matches baseline exactly).
+        // Indices outside the residues fall back to the name-based lookups.
+        const bool indexed = bond.donor_atom_idx < atoms1.size() && bond.acceptor_atom_idx < atoms2.size();
+        char legacy_type = indexed ? BasePairValidator::donor_acceptor(base1_type, base2_type,
+                                                                       atoms1[bond.donor_atom_idx],
+                                                                       atoms2[bond.acceptor_atom_idx])
+                                   : BasePairValidator::donor_acceptor(base1_type, base2_type,
+                                                                       bond.donor_atom_name, bond.acceptor_atom_name);
 
         if (legacy_type == '-') {
             bond.classification = HBondClassification::STANDARD;
         } else if (legacy_type == '*') {
             // Check if this is an AA or DD pair (chemically unlikely)
             // Get atom roles to distinguish AA/DD from ambiguous X-containing combinations
-            HBondAtomRole role1 = HBondRoleClassifier::get_nucleotide_atom_role(base1_type, bond.donor_atom_name);
-            HBondAtomRole role2 = HBondRoleClassifier::get_nucleotide_atom_role(base2_type, bond.acceptor_atom_name);
+            HBondAtomRole role1 =
+                indexed ? HBondRoleClassifier::get_nucleotide_atom_role(base1_type, atoms1[bond.donor_atom_idx])
+                        : HBondRoleClassifier::get_nucleotide_atom_role(base1_type, bond.donor_atom_name);
+            HBondAtomRole role2 =
+                indexed ? HBondRoleClassifier::get_nucleotide_atom_role(base2_type, atoms2[bond.acceptor_atom_idx])
+                        : HBondRoleClassifier::get_nucleotide_atom_role(base2_type, bond.acceptor_atom_name);
 
             // AA or DD pairs are chemically unlikely without protonation/tautomerization
             const bool is_aa = (role1 == HBondAtomRole::ACCEPTOR && role2 == HBondAtomRole::ACCEPTOR);
@@ -646,37 +837,46 @@ void HBondDetector::classify_bonds(std::vector<HBond>& bonds, char base1_type, c
 }
 
 void HBondDetector::calculate_angles(std::vector<HBond>& bonds, const Residue& residue1,
-                                     const Residue& residue2) const {
-    for (auto& bond : bonds) {
-        // Find donor and acceptor positions
-        auto donor_opt = residue1.find_atom(bond.donor_atom_name);
-        auto acceptor_opt = residue2.find_atom(bond.acceptor_atom_name);
+                                     const AngleReferenceTable* references1, const Residue& residue2,
+                                     const AngleReferenceTable* references2) const {
+    const auto& atoms1 = residue1.atoms();
+    const auto& atoms2 = residue2.atoms();
+
+    // Reference neighbor of one H-bond atom: from the table when given, otherwise by name
+    auto reference_atom = [](const Residue& residue, const AngleReferenceTable* references,
+                             size_t atom_idx) -> const Atom* {
+        const auto& atoms = residue.atoms();
+        if (references) {
+            const auto reference = references->angle_reference(atom_idx);
+            return reference ? &atoms[*reference] : nullptr;
+        }
+        const std::string reference_name = HBondGeometry::get_neighbor_atom_name(atoms[atom_idx].name());
+        return reference_name.empty() ? nullptr : residue.find_atom_ptr(reference_name);
+    };
 
-        if (!donor_opt || !acceptor_opt) {
+    for (auto& bond : bonds) {
+        if (bond.donor_atom_idx >= atoms1.size() || bond.acceptor_atom_idx >= atoms2.size()) {
             continue;
         }
 
-        const Vector3D donor_pos = donor_opt->position();
-        const Vector3D acceptor_pos = acceptor_opt->position();
+        const Vector3D& donor_pos = atoms1[bond.donor_atom_idx].position();
+        const Vector3D& acceptor_pos = atoms2[bond.acceptor_atom_idx].position();
 
-        // Find donor neighbor
-        auto donor_neighbor_pos = HBondGeometry::find_neighbor_position(bond.donor_atom_name, residue1);
-        if (donor_neighbor_pos) {
-            bond.donor_angle = HBondGeometry::calculate_angle(*donor_neighbor_pos, donor_pos, acceptor_pos);
-            bond.donor_neighbor_atom = HBondGeometry::get_neighbor_atom_name(bond.donor_atom_name);
+        const Atom* donor_neighbor = reference_atom(residue1, references1, bond.donor_atom_idx);
+        if (donor_neighbor) {
+            bond.donor_angle = HBondGeometry::calculate_angle(donor_neighbor->position(), donor_pos, acceptor_pos);
         }
 
-        // Find acceptor neighbor
-        auto acceptor_neighbor_pos = HBondGeometry::find_neighbor_position(bond.acceptor_atom_name, residue2);
-        if (acceptor_neighbor_pos) {
-            bond.acceptor_angle = HBondGeometry::calculate_angle(donor_pos, acceptor_pos, *acceptor_neighbor_pos);
-            bond.acceptor_neighbor_atom = HBondGeometry::get_neighbor_atom_name(bond.acceptor_atom_name);
+        const Atom* acceptor_neighbor = reference_atom(residue2, references2, bond.acceptor_atom_idx);
+        if (acceptor_neighbor) {
+            bond.acceptor_angle =
+                HBondGeometry::calculate_angle(donor_pos, acceptor_pos, acceptor_neighbor->position());
         }
 
         // Calculate dihedral if both neighbors found
-        if (donor_neighbor_pos && acceptor_neighbor_pos) {
-            bond.dihedral_angle = HBondGeometry::calculate_dihedral(*donor_neighbor_pos, donor_pos, acceptor_pos,
-                                                                    *acceptor_neighbor_pos);
+        if (donor_neighbor && acceptor_neighbor) {
+            bond.dihedral_angle = HBondGeometry::calculate_dihedral(donor_neighbor->position(), donor_pos,
+                                                                    acceptor_pos, acceptor_neighbor->position());
             bond.dihedral_valid = true;
         }
     }
@@ -825,14 +1025,20 @@ StructureHBondResult HBondDetector::detect_all_structure_hbonds(
 
     const double max_dist_sq = max_residue_distance * max_residue_distance;
 
+    // Molecule type of each residue
+    std::vector<MoleculeType> mol_types(n_residues);
+    for (size_t i = 0; i < n_residues; ++i) {
+        mol_types[i] = molecule_type_of(*residues[i]);
+    }
+
     // Detect intra-residue H-bonds if enabled
     if (params_.include_intra_residue) {
         for (size_t i = 0; i < n_residues; ++i) {
-            const MoleculeType mol_type = residues[i]->is_nucleotide() ? MoleculeType::NUCLEIC_ACID
-                                        : residues[i]->is_protein() ? MoleculeType::PROTEIN
-                                        : MoleculeType::LIGAND;
-
-            auto intra_hbonds = detect_intra_residue_hbonds(*residues[i], mol_type);
+            auto intra_hbonds = detect_intra_residue_hbonds(*residues[i], mol_types[i]);
+            for (auto& hb : intra_hbonds) {
+                hb.donor_residue_idx = i;
+                hb.acceptor_residue_idx = i;
+            }
 
             if (!intra_hbonds.empty()) {
                 // Add to grouped result (same residue for both i and j)
@@ -854,85 +1060,196 @@ StructureHBondResult HBondDetector::detect_all_structure_hbonds(
         }
     }
 
-    // Check all residue pairs
+    // Cell list over the polar (allowed-element) atoms of the whole structure. Only residue
+    // pairs with two such atoms within the widest context distance can have an H-bond.
+    std::vector<HBondAtomIndex> indices(n_residues);
+    std::vector<AngleReferenceTable> reference_tables(n_residues);
+    std::vector<Vector3D> polar_positions;
+    std::vector<std::pair<uint32_t, uint32_t>> polar_owners; // (residue, position in polar_atoms)
     for (size_t i = 0; i < n_residues; ++i) {
-        for (size_t j = i + 1; j < n_residues; ++j) {
+        indices[i] = index_atoms(*residues[i]);
+        reference_tables[i] = AngleReferenceTable(*residues[i]);
+        const auto& atoms = residues[i]->atoms();
+        const auto& polar_atoms = indices[i].polar_atoms;
+        for (size_t k = 0; k < polar_atoms.size(); ++k) {
+            polar_positions.push_back(atoms[polar_atoms[k].atom_idx].position());
+            polar_owners.emplace_back(static_cast<uint32_t>(i), static_cast<uint32_t>(k));
+        }
+    }
+    if (polar_positions.empty()) {
+        return result;
+    }
+
+    const size_t num_threads = ThreadPool::resolve_thread_count(num_threads_);
+    const size_t num_polar = polar_positions.size();
+    const bool parallel = num_threads > 1 && num_polar >= 2 * POLAR_ATOMS_PER_TASK;
+    std::optional<ThreadPool> pool;
+    if (parallel) {
+        pool.emplace(std::min(num_threads, (num_polar + POLAR_ATOMS_PER_TASK - 1) / POLAR_ATOMS_PER_TASK));
+    }
+
+    // Atom pairs from each block of query atoms; sorting the concatenation fixes the order
+    const DistanceRange any_context(params_.distances.min_distance, max_context_distance_);
+    const SpatialGrid grid(polar_positions, max_context_distance_);
+    auto collect_atom_pairs = [&](size_t begin, size_t end, std::vector<PolarAtomPair>& out) {
+        std::vector<size_t> nearby;
+        for (size_t a = begin; a < end; ++a) {
+            const auto [residue_a, polar_a] = polar_owners[a];
+            grid.candidates_near(polar_positions[a], nearby);
+            for (size_t b : nearby) {
+                const auto [residue_b, polar_b] = polar_owners[b];
+                if (residue_b <= residue_a) {
+                    continue;
+                }
+                double dist = 0.0;
+                if (any_context.contains(polar_positions[a], polar_positions[b], dist)) {
+                    out.push_back({residue_a, residue_b, polar_a, polar_b});
+                }
+            }
+        }
+    };
+
+    std::vector<PolarAtomPair> atom_pairs;
+    if (parallel) {
+        const size_t num_tasks = (num_polar + POLAR_ATOMS_PER_TASK - 1) / POLAR_ATOMS_PER_TASK;
+        std::vector<std::vector<PolarAtomPair>> task_pairs(num_tasks);
+        pool->parallel_for(num_tasks, [&](size_t task, size_t /* worker */) {
+            collect_atom_pairs(task * POLAR_ATOMS_PER_TASK, std::min(num_polar, (task + 1) * POLAR_ATOMS_PER_TASK),
+                               task_pairs[task]);
+        });
+        for (auto& pairs : task_pairs) {
+            atom_pairs.insert(atom_pairs.end(), pairs.begin(), pairs.end());
+        }
+    } else {
+        collect_atom_pairs(0, num_polar, atom_pairs);
+    }
+    std::sort(atom_pairs.begin(), atom_pairs.end());
+
+    // Start of each residue pair's run of atom pairs, plus an end sentinel
+    std::vector<size_t> group_starts;
+    for (size_t k = 0; k < atom_pairs.size(); ++k) {
+        if (k == 0 || !atom_pairs[k].same_residues(atom_pairs[k - 1])) {
+            group_starts.push_back(k);
+        }
+    }
+    const size_t num_groups = group_starts.size();
+    group_starts.push_back(atom_pairs.size());
+
+    /** @brief Results of a contiguous block of residue pairs, in (i, j) order */
+    struct PairBlockResult {
+        std::vector<ResidueHBonds> pair_hbonds;
+        size_t pairs_checked = 0;
+    };
+
+    // Run each residue pair's atom pairs through the pipeline. Pairs are independent; a
+    // block only appends to its own result, so merging blocks in order keeps (i, j) order.
+    auto detect_block = [&](size_t first_group, size_t last_group, PairBlockResult& block) {
+        for (size_t g = first_group; g < last_group; ++g) {
+            const size_t i = atom_pairs[group_starts[g]].residue_i;
+            const size_t j = atom_pairs[group_starts[g]].residue_j;
+
             // Early rejection based on residue center distance
             const double center_dist_sq = (centers[i] - centers[j]).length_squared();
             if (center_dist_sq > max_dist_sq) {
                 continue;
             }
 
-            ++result.total_residue_pairs_checked;
-
-            // Determine molecule types
-            const MoleculeType mol1_type = residues[i]->is_nucleotide() ? MoleculeType::NUCLEIC_ACID
-                                         : residues[i]->is_protein() ? MoleculeType::PROTEIN
-                                         : MoleculeType::LIGAND;
-            const MoleculeType mol2_type = residues[j]->is_nucleotide() ? MoleculeType::NUCLEIC_ACID
-                                         : residues[j]->is_protein() ? MoleculeType::PROTEIN
-                                         : MoleculeType::LIGAND;
+            ++block.pairs_checked;
+
+            const MoleculeType mol1_type = mol_types[i];
+            const MoleculeType mol2_type = mol_types[j];
+            const auto& atoms1 = residues[i]->atoms();
+            const auto& atoms2 = residues[j]->atoms();
+            const auto& polar1 = indices[i].polar_atoms;
+            const auto& polar2 = indices[j].polar_atoms;
+
+            // Same candidates, in the same order, as find_candidate_bonds over the full indices
+            std::vector<HBond> candidates;
+            for (size_t k = group_starts[g]; k < group_starts[g + 1]; ++k) {
+                const auto& p1 = polar1[atom_pairs[k].polar_i];
+                const auto& p2 = polar2[atom_pairs[k].polar_j];
+                auto hbond = make_candidate_bond(params_, any_context, atoms1[p1.atom_idx], p1, atoms2[p2.atom_idx],
+                                                 p2, false, mol1_type, mol2_type);
+                if (hbond) {
+                    candidates.push_back(std::move(*hbond));
+                }
+            }
 
             // Detect H-bonds between this pair (all atoms, not just base atoms)
-            auto hbonds = detect_all_hbonds_between(*residues[i], *residues[j], mol1_type, mol2_type);
-
-            if (!hbonds.empty()) {
-                // Check if residues are sequence-adjacent nucleotides
-                // If so, filter out backbone-backbone bonds that are part of the phosphodiester linkage
-                const bool both_nucleotides = mol1_type == MoleculeType::NUCLEIC_ACID &&
-                                              mol2_type == MoleculeType::NUCLEIC_ACID;
-                bool is_sequence_adjacent = false;
-
-                if (both_nucleotides) {
-                    // Check if same chain and consecutive sequence numbers
-                    const auto& res1 = *residues[i];
-                    const auto& res2 = *residues[j];
-                    if (res1.chain_id() == res2.chain_id()) {
-                        const int seq_diff = std::abs(res1.seq_num() - res2.seq_num());
-                        is_sequence_adjacent = (seq_diff == 1);
-                    }
-                }
+            auto hbonds = process_candidates(std::move(candidates), *residues[i], *residues[j], mol1_type,
+                                             mol2_type, true, &reference_tables[i], &reference_tables[j])
+                              .final_bonds;
 
-                // Filter out phosphodiester-linked backbone atoms for adjacent residues
-                if (is_sequence_adjacent) {
-                    hbonds.erase(
-                        std::remove_if(hbonds.begin(), hbonds.end(),
-                            [](const HBond& hb) {
-                                return hb.context == HBondContext::BACKBONE_BACKBONE &&
-                                       is_phosphodiester_pair(hb.donor_atom_name, hb.acceptor_atom_name);
-                            }),
-                        hbonds.end());
-                }
+            if (hbonds.empty()) {
+                continue;
+            }
 
-                if (hbonds.empty()) {
-                    continue;  // All bonds were filtered out
+            // Check if residues are sequence-adjacent nucleotides
+            // If so, filter out backbone-backbone bonds that are part of the phosphodiester linkage
+            const bool both_nucleotides =
+                mol1_type == MoleculeType::NUCLEIC_ACID && mol2_type == MoleculeType::NUCLEIC_ACID;
+            bool is_sequence_adjacent = false;
+
+            if (both_nucleotides) {
+                // Check if same chain and consecutive sequence numbers
+                const auto& res1 = *residues[i];
+                const auto& res2 = *residues[j];
+                if (res1.chain_id() == res2.chain_id()) {
+                    const int seq_diff = std::abs(res1.seq_num() - res2.seq_num());
+                    is_sequence_adjacent = (seq_diff == 1);
                 }
+            }
 
-                ++result.pairs_with_hbonds;
+            // Filter out phosphodiester-linked backbone atoms for adjacent residues
+            if (is_sequence_adjacent) {
+                hbonds.erase(std::remove_if(hbonds.begin(), hbonds.end(),
+                                            [](const HBond& hb) {
+                                                return hb.context == HBondContext::BACKBONE_BACKBONE &&
+                                                       is_phosphodiester_pair(hb.donor_atom_name,
+                                                                              hb.acceptor_atom_name);
+                                            }),
+                             hbonds.end());
+            }
 
-                // Set residue info on each H-bond
-                for (auto& hb : hbonds) {
-                    hb.donor_res_id = residues[i]->res_id();
-                    hb.acceptor_res_id = residues[j]->res_id();
-                    hb.donor_residue_idx = i;
-                    hb.acceptor_residue_idx = j;
-                }
+            if (hbonds.empty()) {
+                continue; // All bonds were filtered out
+            }
 
-                // Add to grouped result
-                ResidueHBonds pair_result;
-                pair_result.res_id_i = residues[i]->res_id();
-                pair_result.res_id_j = residues[j]->res_id();
-                pair_result.residue_idx_i = i;
-                pair_result.residue_idx_j = j;
-                pair_result.hbonds = std::move(hbonds);
+            // Set residue info on each H-bond
+            for (auto& hb : hbonds) {
+                hb.donor_residue_idx = i;
+                hb.acceptor_residue_idx = j;
+            }
 
-                // Also add to flat list
-                for (const auto& hb : pair_result.hbonds) {
-                    result.all_hbonds.push_back(hb);
-                }
+            ResidueHBonds pair_result;
+            pair_result.res_id_i = residues[i]->res_id();
+            pair_result.res_id_j = residues[j]->res_id();
+            pair_result.residue_idx_i = i;
+            pair_result.residue_idx_j = j;
+            pair_result.hbonds = std::move(hbonds);
+            block.pair_hbonds.push_back(std::move(pair_result));
+        }
+    };
 
-                result.residue_pair_hbonds.push_back(std::move(pair_result));
-            }
+    std::vector<PairBlockResult> blocks;
+    if (parallel && num_groups >= 2 * RESIDUE_PAIRS_PER_TASK) {
+        blocks.resize((num_groups + RESIDUE_PAIRS_PER_TASK - 1) / RESIDUE_PAIRS_PER_TASK);
+        pool->parallel_for(blocks.size(), [&](size_t task, size_t /* worker */) {
+            detect_block(task * RESIDUE_PAIRS_PER_TASK, std::min(num_groups, (task + 1) * RESIDUE_PAIRS_PER_TASK),
+                         blocks[task]);
+        });
+    } else {
+        blocks.resize(1);
+        detect_block(0, num_groups, blocks[0]);
+    }
+
+    // Merge blocks in order into the grouped and flat lists
+    for (auto& block : blocks) {
+        result.total_residue_pairs_checked += block.pairs_checked;
+        for (auto& pair_result : block.pair_hbonds) {
+            ++result.pairs_with_hbonds;
+            result.all_hbonds.insert(result.all_hbonds.end(), pair_result.hbonds.begin(), pair_result.hbonds.end());
+            result.residue_pair_hbonds.push_back(std::move(pair_result));
         }
     }
 
@@ -948,11 +1265,6 @@ void HBondDetector::apply_global_occupancy_filter(
         return;
     }
 
-    // Build unique atom identifiers: "res_id:atom_name"
-    auto make_atom_id = [](const std::string& res_id, const std::string& atom_name) {
-        return res_id + ":" + atom_name;
-    };
-
     // Sort all H-bonds by distance only (shortest first)
     // Note: Our "donor" and "acceptor" labels are based on residue order, not chemistry
     // So we track each atom uniformly using max_bonds_per_acceptor as the limit
@@ -966,7 +1278,8 @@ void HBondDetector::apply_global_occupancy_filter(
     // Track occupancy for each atom (uniform tracking, not role-based)
     // Since our donor/acceptor labels don't reflect actual chemistry,
     // we use the same limit for all atoms
-    std::unordered_map<std::string, int> atom_occupancy;
+    const HBondAtomSlots slots(result.all_hbonds);
+    std::vector<int> atom_occupancy(slots.size(), 0);
 
     // Mark which bonds to keep
     std::vector<bool> keep_bond(result.all_hbonds.size(), false);
@@ -976,26 +1289,20 @@ void HBondDetector::apply_global_occupancy_filter(
 
     // Greedy selection: process bonds in distance order
     for (size_t idx : sorted_indices) {
-        const auto& hb = result.all_hbonds[idx];
-
-        // Create unique atom identifiers for both atoms in the bond
-        const std::string atom1_id = make_atom_id(hb.donor_res_id, hb.donor_atom_name);
-        const std::string atom2_id = make_atom_id(hb.acceptor_res_id, hb.acceptor_atom_name);
+        int& atom1_count = atom_occupancy[slots.donor(idx)];
+        int& atom2_count = atom_occupancy[slots.acceptor(idx)];
 
         // Check if both atoms have capacity
-        const int atom1_count = atom_occupancy[atom1_id];
-        const int atom2_count = atom_occupancy[atom2_id];
-
         if (atom1_count < max_bonds_per_atom && atom2_count < max_bonds_per_atom) {
             // Keep this bond
             keep_bond[idx] = true;
-            atom_occupancy[atom1_id]++;
-            atom_occupancy[atom2_id]++;
+            atom1_count++;
+            atom2_count++;
         }
     }
 
     // Filter all_hbonds
-    std::vector<core::HBond> filtered_hbonds;
+    std::vector<HBond> filtered_hbonds;
     filtered_hbonds.reserve(result.all_hbonds.size());
     for (size_t i = 0; i < result.all_hbonds.size(); ++i) {
         if (keep_bond[i]) {
@@ -1004,35 +1311,86 @@ void HBondDetector::apply_global_occupancy_filter(
     }
     result.all_hbonds = std::move(filtered_hbonds);
 
-    // Rebuild residue_pair_hbonds from filtered bonds
-    // Group by (res_id_i, res_id_j) pair
-    std::map<std::pair<std::string, std::string>, std::vector<core::HBond>> grouped;
-    for (auto& hb : result.all_hbonds) {
-        // Determine which residue is "i" and which is "j" based on original order
-        std::string res_i = hb.donor_res_id;
-        std::string res_j = hb.acceptor_res_id;
-        // For intra-residue, both are the same
-        if (res_i == res_j) {
-            grouped[{res_i, res_j}].push_back(hb);
-        } else {
-            // Ensure consistent ordering (smaller res_id first)
-            if (res_i > res_j) {
-                std::swap(res_i, res_j);
-            }
-            grouped[{res_i, res_j}].push_back(hb);
+    // Rebuild residue_pair_hbonds from filtered bonds, smaller res_id first
+    regroup_residue_pair_hbonds(result, true);
+}
+
+HBondAtomSlots::HBondAtomSlots(const std::vector<HBond>& bonds) : slots_(2 * bonds.size()) {
+    // (residue index, atom index) keys sorted with their positions, then numbered
+    std::vector<std::pair<std::pair<size_t, size_t>, size_t>> keys;
+    keys.reserve(2 * bonds.size());
+    for (size_t b = 0; b < bonds.size(); ++b) {
+        keys.push_back({{bonds[b].donor_residue_idx, bonds[b].donor_atom_idx}, 2 * b});
+        keys.push_back({{bonds[b].acceptor_residue_idx, bonds[b].acceptor_atom_idx}, 2 * b + 1});
+    }
+    std::sort(keys.begin(), keys.end());
+    for (size_t k = 0; k < keys.size(); ++k) {
+        if (k > 0 && keys[k].first != keys[k - 1].first) {
+            ++num_atoms_;
+        }
+        slots_[keys[k].second] = num_atoms_;
+    }
+    if (!keys.empty()) {
+        ++num_atoms_;
+    }
+}
+
+void regroup_residue_pair_hbonds(StructureHBondResult& result, bool symmetric_pairs) {
+    // Residue IDs by residue index, from the groups being replaced
+    std::vector<std::string> res_ids;
+    for (const auto& pair : result.residue_pair_hbonds) {
+        res_ids.resize(std::max({res_ids.size(), pair.residue_idx_i + 1, pair.residue_idx_j + 1}));
+        res_ids[pair.residue_idx_i] = pair.res_id_i;
+        res_ids[pair.residue_idx_j] = pair.res_id_j;
+    }
+    for (const auto& hb : result.all_hbonds) {
+        res_ids.resize(std::max({res_ids.size(), hb.donor_residue_idx + 1, hb.acceptor_residue_idx + 1}));
+    }
+
+    // Rank of each residue's ID; equal IDs share a rank
+    std::vector<size_t> by_id(res_ids.size());
+    std::iota(by_id.begin(), by_id.end(), 0);
+    std::sort(by_id.begin(), by_id.end(), [&res_ids](size_t a, size_t b) { return res_ids[a] < res_ids[b]; });
+    std::vector<size_t> rank(res_ids.size(), 0);
+    for (size_t k = 1; k < by_id.size(); ++k) {
+        rank[by_id[k]] = rank[by_id[k - 1]] + (res_ids[by_id[k - 1]] < res_ids[by_id[k]] ? 1 : 0);
+    }
+
+    // (rank i, rank j, bond) for every bond; sorting groups pairs in ID order, bonds in list order
+    struct GroupedBond {
+        size_t rank_i;
+        size_t rank_j;
+        size_t bond;
+        size_t residue_i;
+        size_t residue_j;
+    };
+    std::vector<GroupedBond> grouped;
+    grouped.reserve(result.all_hbonds.size());
+    for (size_t b = 0; b < result.all_hbonds.size(); ++b) {
+        size_t residue_i = result.all_hbonds[b].donor_residue_idx;
+        size_t residue_j = result.all_hbonds[b].acceptor_residue_idx;
+        if (symmetric_pairs && rank[residue_i] > rank[residue_j]) {
+            std::swap(residue_i, residue_j);
         }
+        grouped.push_back({rank[residue_i], rank[residue_j], b, residue_i, residue_j});
     }
+    std::sort(grouped.begin(), grouped.end(), [](const GroupedBond& a, const GroupedBond& b) {
+        return std::tie(a.rank_i, a.rank_j, a.bond) < std::tie(b.rank_i, b.rank_j, b.bond);
+    });
 
-    // Rebuild residue_pair_hbonds
     result.residue_pair_hbonds.clear();
     result.pairs_with_hbonds = 0;
-    for (auto& [key, hbonds] : grouped) {
-        ResidueHBonds pair_result;
-        pair_result.res_id_i = key.first;
-        pair_result.res_id_j = key.second;
-        pair_result.hbonds = std::move(hbonds);
-        result.residue_pair_hbonds.push_back(std::move(pair_result));
-        ++result.pairs_with_hbonds;
+    for (size_t k = 0; k < grouped.size(); ++k) {
+        if (k == 0 || grouped[k].rank_i != grouped[k - 1].rank_i || grouped[k].rank_j != grouped[k - 1].rank_j) {
+            ResidueHBonds pair_result;
+            pair_result.res_id_i = res_ids[grouped[k].residue_i];
+            pair_result.res_id_j = res_ids[grouped[k].residue_j];
+            pair_result.residue_idx_i = grouped[k].residue_i;
+            pair_result.residue_idx_j = grouped[k].residue_j;
+            result.residue_pair_hbonds.push_back(std::move(pair_result));
+            ++result.pairs_with_hbonds;
+        }
+        result.residue_pair_hbonds.back().hbonds.push_back(result.all_hbonds[grouped[k].bond]);
     }
 }
 
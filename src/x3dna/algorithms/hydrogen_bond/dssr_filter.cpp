@@ -8,8 +8,6 @@
 #include <x3dna/algorithms/hydrogen_bond/quality_scorer.hpp>
 #include <algorithm>
 #include <cctype>
-#include <map>
-#include <unordered_map>
 #include <vector>
 
 namespace x3dna {
@@ -220,25 +218,8 @@ void DSSRStyleFilter::filter_in_place(StructureHBondResult& result, const DSSRFi
         all.end());
 
     // Rebuild residue_pair_hbonds from filtered bonds
-    // Group by (donor_res_id, acceptor_res_id) pair - preserve original order!
-    // IMPORTANT: Do NOT swap res_ids, as donor_atom is defined to come from res_id_i
-    std::map<std::pair<std::string, std::string>, std::vector<core::HBond>> grouped;
-    for (const auto& hb : all) {
-        // Keep original ordering: donor_res_id = res_id_i, acceptor_res_id = res_id_j
-        grouped[{hb.donor_res_id, hb.acceptor_res_id}].push_back(hb);
-    }
-
-    // Rebuild residue_pair_hbonds
-    result.residue_pair_hbonds.clear();
-    result.pairs_with_hbonds = 0;
-    for (auto& [key, hbonds] : grouped) {
-        ResidueHBonds pair_result;
-        pair_result.res_id_i = key.first;
-        pair_result.res_id_j = key.second;
-        pair_result.hbonds = std::move(hbonds);
-        result.residue_pair_hbonds.push_back(std::move(pair_result));
-        ++result.pairs_with_hbonds;
-    }
+    // IMPORTANT: Do NOT swap residues, as donor_atom is defined to come from res_id_i
+    regroup_residue_pair_hbonds(result, false);
 }
 
 void DSSRStyleFilter::apply_scored_occupancy_filter(StructureHBondResult& result, int max_bonds_per_atom) {
@@ -254,11 +235,6 @@ void DSSRStyleFilter::apply_scored_occupancy_filter(StructureHBondResult& result
         }
     }
 
-    // Helper to create atom ID
-    auto make_atom_id = [](const std::string& res_id, const std::string& atom_name) {
-        return res_id + ":" + atom_name;
-    };
-
     // Helper to get score (use 0 if not available)
     auto get_score = [](const core::HBond& hb) -> double {
         if (hb.quality_score.has_value()) {
@@ -288,9 +264,10 @@ void DSSRStyleFilter::apply_scored_occupancy_filter(StructureHBondResult& result
               [](const auto& a, const auto& b) { return a.second > b.second; });
 
     // Track how many bonds each atom participates in
-    std::unordered_map<std::string, int> atom_bond_count;
-    // Track atom capacities (cache for efficiency)
-    std::unordered_map<std::string, int> atom_capacities;
+    const HBondAtomSlots slots(result.all_hbonds);
+    std::vector<int> atom_bond_count(slots.size(), 0);
+    // Track atom capacities (cache for efficiency; -1 = not computed yet)
+    std::vector<int> atom_capacities(slots.size(), -1);
 
     // Mark which bonds to keep
     std::vector<bool> keep_bond(result.all_hbonds.size(), false);
@@ -299,15 +276,15 @@ void DSSRStyleFilter::apply_scored_occupancy_filter(StructureHBondResult& result
     for (const auto& [idx, score] : indexed_scores) {
         const auto& hb = result.all_hbonds[idx];
 
-        // Get atom IDs for both atoms
-        const std::string atom1_id = make_atom_id(hb.donor_res_id, hb.donor_atom_name);
-        const std::string atom2_id = make_atom_id(hb.acceptor_res_id, hb.acceptor_atom_name);
+        // Slots for both atoms
+        const size_t atom1_id = slots.donor(idx);
+        const size_t atom2_id = slots.acceptor(idx);
 
         // Get or compute capacities
-        if (atom_capacities.find(atom1_id) == atom_capacities.end()) {
+        if (atom_capacities[atom1_id] < 0) {
             atom_capacities[atom1_id] = get_capacity(hb.donor_atom_name);
         }
-        if (atom_capacities.find(atom2_id) == atom_capacities.end()) {
+        if (atom_capacities[atom2_id] < 0) {
             atom_capacities[atom2_id] = get_capacity(hb.acceptor_atom_name);
         }
 
@@ -331,21 +308,7 @@ void DSSRStyleFilter::apply_scored_occupancy_filter(StructureHBondResult& result
     result.all_hbonds = std::move(filtered);
 
     // Rebuild residue_pair_hbonds
-    std::map<std::pair<std::string, std::string>, std::vector<core::HBond>> grouped;
-    for (const auto& hb : result.all_hbonds) {
-        grouped[{hb.donor_res_id, hb.acceptor_res_id}].push_back(hb);
-    }
-
-    result.residue_pair_hbonds.clear();
-    result.pairs_with_hbonds = 0;
-    for (auto& [key, hbonds] : grouped) {
-        ResidueHBonds pair_result;
-        pair_result.res_id_i = key.first;
-        pair_result.res_id_j = key.second;
-        pair_result.hbonds = std::move(hbonds);
-        result.residue_pair_hbonds.push_back(std::move(pair_result));
-        ++result.pairs_with_hbonds;
-    }
+    regroup_residue_pair_hbonds(result, false);
 }
 
 } // namespace hydrogen_bond
@@ -4,6 +4,7 @@
  */
 
 #include <x3dna/algorithms/hydrogen_bond/edge_classifier.hpp>
+#include <x3dna/algorithms/hydrogen_bond/atom_type_tables.hpp>
 #include <unordered_map>
 #include <unordered_set>
 #include <cctype>
@@ -143,6 +144,17 @@ core::BaseEdge EdgeClassifier::classify(const std::string& atom_name, char base_
     return core::BaseEdge::UNKNOWN;
 }
 
+core::BaseEdge EdgeClassifier::classify(const core::Atom& atom, char base_type) {
+    if (!atom_type_tables::uses_atom_type_tables(atom)) {
+        return classify(atom.name(), base_type);
+    }
+    const size_t base = atom_type_tables::edge_base_index(base_type);
+    if (base == atom_type_tables::NUM_EDGE_BASES) {
+        return core::BaseEdge::UNKNOWN;
+    }
+    return atom_type_tables::EDGES[base][static_cast<size_t>(atom.atom_type())];
+}
+
 core::BaseEdge EdgeClassifier::classify_from_residue(const std::string& atom_name,
                                                       const std::string& residue_name) {
     char base_type = get_base_type(residue_name);
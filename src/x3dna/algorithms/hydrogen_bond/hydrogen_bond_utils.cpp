@@ -35,27 +35,13 @@ bool is_base_atom(const std::string& atom_name) {
     return false;
 }
 
-bool good_hb_atoms(const std::string& atom1, const std::string& atom2, const std::string& hb_atoms,
-                   bool include_backbone_backbone) {
-    // Match legacy good_hbatoms() logic EXACTLY (lines 3864-3877 in cmn_fncs.c)
-    // Input atom names are already trimmed from Atom class
-
-    // Step 1: PO list check (matches legacy lines 3866-3870)
-    // Skip this check if include_backbone_backbone is true (for DSSR-like detection)
-    // Note: Legacy PO list has 6 elements and uses numPO = sizeof(PO)/sizeof(PO[0]) - 1 = 5,
-    // but the loop is 'for (i = nb; i <= ne; i++)' which is INCLUSIVE of index 5 (N7).
-    // So legacy DOES check all 6 elements including N7.
-    if (!include_backbone_backbone) {
-        // Include both old (O1P/O2P) and new (OP1/OP2) atom naming conventions
-        static const std::vector<std::string> PO = {"O1P", "O2P", "OP1", "OP2", "O3'", "O4'", "O5'", "N7"};
-        bool atom1_in_po = std::find(PO.begin(), PO.end(), atom1) != PO.end();
-        bool atom2_in_po = std::find(PO.begin(), PO.end(), atom2) != PO.end();
-        if (atom1_in_po && atom2_in_po) {
-            return false;
-        }
-    }
+bool is_po_list_atom(const std::string& atom_name) {
+    // Include both old (O1P/O2P) and new (OP1/OP2) atom naming conventions
+    static const std::vector<std::string> PO = {"O1P", "O2P", "OP1", "OP2", "O3'", "O4'", "O5'", "N7"};
+    return std::find(PO.begin(), PO.end(), atom_name) != PO.end();
+}
 
-    // Step 2: idx-based check (matches legacy lines 3871-3874)
+std::vector<int> parse_hb_atom_indices(const std::string& hb_atoms) {
     // Build hb_idx array from hb_atoms string (format: ".O.N" means O and N)
     std::vector<int> hb_idx;
     std::string hb_atoms_upper = hb_atoms;
@@ -75,6 +61,27 @@ bool good_hb_atoms(const std::string& atom1, const std::string& atom2, const std
             }
         }
     }
+    return hb_idx;
+}
+
+bool good_hb_atoms(const std::string& atom1, const std::string& atom2, const std::string& hb_atoms,
+                   bool include_backbone_backbone) {
+    // Match legacy good_hbatoms() logic EXACTLY (lines 3864-3877 in cmn_fncs.c)
+    // Input atom names are already trimmed from Atom class
+
+    // Step 1: PO list check (matches legacy lines 3866-3870)
+    // Skip this check if include_backbone_backbone is true (for DSSR-like detection)
+    // Note: Legacy PO list has 6 elements and uses numPO = sizeof(PO)/sizeof(PO[0]) - 1 = 5,
+    // but the loop is 'for (i = nb; i <= ne; i++)' which is INCLUSIVE of index 5 (N7).
+    // So legacy DOES check all 6 elements including N7.
+    if (!include_backbone_backbone) {
+        if (is_po_list_atom(atom1) && is_po_list_atom(atom2)) {
+            return false;
+        }
+    }
+
+    // Step 2: idx-based check (matches legacy lines 3871-3874)
+    const std::vector<int> hb_idx = parse_hb_atom_indices(hb_atoms);
 
     // Get atom indices via the registry (delegates to AtomSymbolRegistry)
     int idx1 = AtomListUtils::get_atom_idx(atom1);
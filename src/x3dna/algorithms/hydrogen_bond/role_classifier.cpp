@@ -4,6 +4,7 @@
  */
 
 #include <x3dna/algorithms/hydrogen_bond/role_classifier.hpp>
+#include <x3dna/algorithms/hydrogen_bond/atom_type_tables.hpp>
 #include <cctype>
 #include <cstring>
 #include <algorithm>
@@ -307,6 +308,14 @@ HBondAtomRole HBondRoleClassifier::get_nucleotide_atom_role(char base, const std
     return get_element_based_role(atom_name);
 }
 
+HBondAtomRole HBondRoleClassifier::get_nucleotide_atom_role(char base, const Atom& atom) {
+    namespace tables = hydrogen_bond::atom_type_tables;
+    if (!tables::uses_atom_type_tables(atom)) {
+        return get_nucleotide_atom_role(base, atom.name());
+    }
+    return tables::ROLES[tables::legacy_base_index(base)][static_cast<size_t>(atom.atom_type())];
+}
+
 HBondAtomRole HBondRoleClassifier::get_element_based_role(const std::string& atom_name) {
     std::string elem = extract_element(atom_name);
     if (elem.empty()) {
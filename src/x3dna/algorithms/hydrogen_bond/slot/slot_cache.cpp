@@ -4,66 +4,135 @@
  */
 
 #include <x3dna/algorithms/hydrogen_bond/slot/slot_cache.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/atom_capacity.hpp>
 
 namespace x3dna {
 namespace algorithms {
 namespace hydrogen_bond {
 namespace slot {
 
-SlotCache::SlotCache(const core::Residue& residue, char base_type)
-    : residue_(residue)
-    , base_type_(base_type) {
+SlotCache::SlotCache(const core::Residue& residue, char base_type) {
+    rebind(residue, base_type);
+}
+
+SlotCache::SlotCache(const SlotStore& store, size_t residue_idx) {
+    rebind(store, residue_idx);
+}
+
+void SlotCache::rebind(const core::Residue& residue, char base_type) {
+    residue_ = &residue;
+    base_type_ = base_type;
+    store_ = nullptr;
+    residue_idx_ = 0;
+    clear();
+}
+
+void SlotCache::rebind(const SlotStore& store, size_t residue_idx) {
+    residue_ = &store.residue(residue_idx);
+    base_type_ = store.base_type(residue_idx);
+    store_ = &store;
+    residue_idx_ = residue_idx;
+    clear();
 }
 
 void SlotCache::ensure_base_normal() {
     if (!normal_computed_) {
-        base_normal_ = SlotPredictor::compute_base_normal(residue_);
+        base_normal_ = SlotPredictor::compute_base_normal(*residue_);
         normal_computed_ = true;
     }
 }
 
-std::vector<HSlot>& SlotCache::get_h_slots(const std::string& atom_name) {
-    auto it = h_slots_.find(atom_name);
-    if (it != h_slots_.end()) {
-        return it->second;
+void SlotCache::resize_for_residue() {
+    const size_t num_atoms = residue_ ? residue_->num_atoms() : 0;
+    // Keep the inner vectors' buffers; only their contents are stale
+    if (h_slots_.size() < num_atoms) {
+        h_slots_.resize(num_atoms);
+        lp_slots_.resize(num_atoms);
+    }
+    cached_.assign(num_atoms, 0);
+}
+
+size_t SlotCache::find_atom_index(const std::string& atom_name) const {
+    const auto& atoms = residue_->atoms();
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        if (atoms[i].name() == atom_name) {
+            return i;
+        }
     }
+    return atoms.size();
+}
 
-    // Compute and cache
-    ensure_base_normal();
-    auto slots = SlotPredictor::predict_h_slots(base_type_, atom_name, residue_, base_normal_);
-    auto [inserted_it, _] = h_slots_.emplace(atom_name, std::move(slots));
-    return inserted_it->second;
+std::vector<HSlot>& SlotCache::get_h_slots(const std::string& atom_name) {
+    const size_t atom_idx = find_atom_index(AtomCapacity::normalize_atom_name(atom_name));
+    if (atom_idx == cached_.size()) {
+        no_h_slots_.clear();
+        return no_h_slots_;
+    }
+    return get_h_slots(atom_idx);
 }
 
 std::vector<LPSlot>& SlotCache::get_lp_slots(const std::string& atom_name) {
-    auto it = lp_slots_.find(atom_name);
-    if (it != lp_slots_.end()) {
-        return it->second;
+    const size_t atom_idx = find_atom_index(AtomCapacity::normalize_atom_name(atom_name));
+    if (atom_idx == cached_.size()) {
+        no_lp_slots_.clear();
+        return no_lp_slots_;
+    }
+    return get_lp_slots(atom_idx);
+}
+
+std::vector<HSlot>& SlotCache::get_h_slots(size_t atom_idx) {
+    auto& slots = h_slots_[atom_idx];
+    if (cached_[atom_idx] & H_CACHED) {
+        return slots;
+    }
+
+    // Copy from the store, or compute
+    if (store_) {
+        store_->h_slots(residue_idx_, atom_idx, slots);
+    } else {
+        ensure_base_normal();
+        slots = SlotPredictor::predict_h_slots(base_type_, residue_->atoms()[atom_idx].name(), *residue_,
+                                               base_normal_);
+    }
+    cached_[atom_idx] |= H_CACHED;
+    return slots;
+}
+
+std::vector<LPSlot>& SlotCache::get_lp_slots(size_t atom_idx) {
+    auto& slots = lp_slots_[atom_idx];
+    if (cached_[atom_idx] & LP_CACHED) {
+        return slots;
     }
 
-    // Compute and cache
-    ensure_base_normal();
-    auto slots = SlotPredictor::predict_lp_slots(base_type_, atom_name, residue_, base_normal_);
-    auto [inserted_it, _] = lp_slots_.emplace(atom_name, std::move(slots));
-    return inserted_it->second;
+    // Copy from the store, or compute
+    if (store_) {
+        store_->lp_slots(residue_idx_, atom_idx, slots);
+    } else {
+        ensure_base_normal();
+        slots = SlotPredictor::predict_lp_slots(base_type_, residue_->atoms()[atom_idx].name(), *residue_,
+                                                base_normal_);
+    }
+    cached_[atom_idx] |= LP_CACHED;
+    return slots;
 }
 
 void SlotCache::reset_slots() {
-    for (auto& [name, slots] : h_slots_) {
-        for (auto& slot : slots) {
-            slot.reset();
+    for (size_t i = 0; i < cached_.size(); ++i) {
+        if (cached_[i] & H_CACHED) {
+            for (auto& slot : h_slots_[i]) {
+                slot.reset();
+            }
         }
-    }
-    for (auto& [name, slots] : lp_slots_) {
-        for (auto& slot : slots) {
-            slot.reset();
+        if (cached_[i] & LP_CACHED) {
+            for (auto& slot : lp_slots_[i]) {
+                slot.reset();
+            }
         }
     }
 }
 
 void SlotCache::clear() {
-    h_slots_.clear();
-    lp_slots_.clear();
+    resize_for_residue();
     normal_computed_ = false;
 }
 
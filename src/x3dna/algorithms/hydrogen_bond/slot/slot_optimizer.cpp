@@ -59,13 +59,35 @@ std::vector<core::HBond> SlotOptimizer::optimize_pair(
         return select_baseline(candidates, res1, res2);
     }
 
-    // Create slot caches
-    char base1 = get_base_type(res1);
-    char base2 = get_base_type(res2);
-    SlotCache cache1(res1, base1);
-    SlotCache cache2(res2, base2);
+    // Rebind the pooled slot caches
+    cache1_.rebind(res1, get_base_type(res1));
+    cache2_.rebind(res2, get_base_type(res2));
 
-    return select_optimal(candidates, cache1, cache2);
+    return select_optimal(candidates, cache1_, cache2_);
+}
+
+std::vector<core::HBond> SlotOptimizer::optimize_pair(
+    const SlotStore& store,
+    size_t residue_idx1,
+    size_t residue_idx2) {
+
+    const core::Residue& res1 = store.residue(residue_idx1);
+    const core::Residue& res2 = store.residue(residue_idx2);
+    auto candidates = find_candidates(res1, res2);
+
+    if (candidates.empty()) {
+        return {};
+    }
+
+    if (params_.baseline_mode) {
+        return select_baseline(candidates, res1, res2);
+    }
+
+    // Slots come from the store instead of being predicted for this pair
+    cache1_.rebind(store, residue_idx1);
+    cache2_.rebind(store, residue_idx2);
+
+    return select_optimal(candidates, cache1_, cache2_);
 }
 
 std::vector<HBondCandidate> SlotOptimizer::find_candidates(
@@ -77,13 +99,17 @@ std::vector<HBondCandidate> SlotOptimizer::find_candidates(
     std::string code2 = res2.name();
 
     // Check res1 donors -> res2 acceptors
-    for (const auto& donor_atom : res1.atoms()) {
+    const auto& atoms1 = res1.atoms();
+    const auto& atoms2 = res2.atoms();
+    for (size_t i = 0; i < atoms1.size(); ++i) {
+        const auto& donor_atom = atoms1[i];
         std::string donor_name = AtomCapacity::normalize_atom_name(donor_atom.name());
         if (AtomCapacity::get_donor_capacity(code1, donor_name) == 0) {
             continue;
         }
 
-        for (const auto& acceptor_atom : res2.atoms()) {
+        for (size_t j = 0; j < atoms2.size(); ++j) {
+            const auto& acceptor_atom = atoms2[j];
             std::string acceptor_name = AtomCapacity::normalize_atom_name(acceptor_atom.name());
             if (AtomCapacity::get_acceptor_capacity(code2, acceptor_name) == 0) {
                 continue;
@@ -96,6 +122,8 @@ std::vector<HBondCandidate> SlotOptimizer::find_candidates(
                 c.acceptor_res_id = res2.res_id();
                 c.donor_atom = donor_name;
                 c.acceptor_atom = acceptor_name;
+                c.donor_atom_idx = i;
+                c.acceptor_atom_idx = j;
                 c.donor_pos = donor_atom.position();
                 c.acceptor_pos = acceptor_atom.position();
                 c.distance = dist;
@@ -105,13 +133,15 @@ std::vector<HBondCandidate> SlotOptimizer::find_candidates(
     }
 
     // Check res2 donors -> res1 acceptors
-    for (const auto& donor_atom : res2.atoms()) {
+    for (size_t i = 0; i < atoms2.size(); ++i) {
+        const auto& donor_atom = atoms2[i];
         std::string donor_name = AtomCapacity::normalize_atom_name(donor_atom.name());
         if (AtomCapacity::get_donor_capacity(code2, donor_name) == 0) {
             continue;
         }
 
-        for (const auto& acceptor_atom : res1.atoms()) {
+        for (size_t j = 0; j < atoms1.size(); ++j) {
+            const auto& acceptor_atom = atoms1[j];
             std::string acceptor_name = AtomCapacity::normalize_atom_name(acceptor_atom.name());
             if (AtomCapacity::get_acceptor_capacity(code1, acceptor_name) == 0) {
                 continue;
@@ -124,6 +154,8 @@ std::vector<HBondCandidate> SlotOptimizer::find_candidates(
                 c.acceptor_res_id = res1.res_id();
                 c.donor_atom = donor_name;
                 c.acceptor_atom = acceptor_name;
+                c.donor_atom_idx = i;
+                c.acceptor_atom_idx = j;
                 c.donor_pos = donor_atom.position();
                 c.acceptor_pos = acceptor_atom.position();
                 c.distance = dist;
@@ -225,8 +257,8 @@ std::vector<core::HBond> SlotOptimizer::select_optimal(
         SlotCache& donor_cache = (c.donor_res_id == cache1.residue().res_id()) ? cache1 : cache2;
         SlotCache& acceptor_cache = (c.acceptor_res_id == cache1.residue().res_id()) ? cache1 : cache2;
 
-        auto& h_slots = donor_cache.get_h_slots(c.donor_atom);
-        auto& lp_slots = acceptor_cache.get_lp_slots(c.acceptor_atom);
+        auto& h_slots = donor_cache.get_h_slots(c.donor_atom_idx);
+        auto& lp_slots = acceptor_cache.get_lp_slots(c.acceptor_atom_idx);
 
         score_alignment(c, h_slots, lp_slots);
     }
@@ -243,8 +275,8 @@ std::vector<core::HBond> SlotOptimizer::select_optimal(
         SlotCache& donor_cache = (c.donor_res_id == cache1.residue().res_id()) ? cache1 : cache2;
         SlotCache& acceptor_cache = (c.acceptor_res_id == cache1.residue().res_id()) ? cache1 : cache2;
 
-        auto& h_slots = donor_cache.get_h_slots(c.donor_atom);
-        auto& lp_slots = acceptor_cache.get_lp_slots(c.acceptor_atom);
+        auto& h_slots = donor_cache.get_h_slots(c.donor_atom_idx);
+        auto& lp_slots = acceptor_cache.get_lp_slots(c.acceptor_atom_idx);
 
         if (h_slots.empty() || lp_slots.empty()) {
             continue;
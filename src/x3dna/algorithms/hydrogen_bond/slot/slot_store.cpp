@@ -0,0 +1,103 @@
+/**
+ * @file slot_store.cpp
+ * @brief Implementation of SlotStore
+ */
+
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_store.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/atom_capacity.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_optimizer.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_predictor.hpp>
+#include <string>
+
+namespace x3dna {
+namespace algorithms {
+namespace hydrogen_bond {
+namespace slot {
+
+namespace {
+
+template <typename T>
+void release_if_above(std::vector<T>& buffer, size_t limit) {
+    if (buffer.capacity() > limit) {
+        std::vector<T>().swap(buffer);
+    } else {
+        buffer.clear();
+    }
+}
+
+} // namespace
+
+void SlotStore::assign(const std::vector<const core::Residue*>& residues) {
+    residues_.clear();
+    atoms_.clear();
+    h_directions_.clear();
+    lp_directions_.clear();
+    residues_.reserve(residues.size());
+
+    for (const core::Residue* residue : residues) {
+        const char base_type = SlotOptimizer::get_base_type(*residue);
+        const std::string code(1, base_type);
+        const auto frame = residue->reference_frame();
+        const geometry::Matrix3D rotation = frame ? frame->rotation() : geometry::Matrix3D::identity();
+        const geometry::Matrix3D to_local = rotation.transpose();
+        residues_.push_back({residue, base_type, rotation, atoms_.size()});
+
+        bool normal_computed = false;
+        geometry::Vector3D base_normal;
+        for (const auto& atom : residue->atoms()) {
+            AtomSlots entry;
+            const std::string name = AtomCapacity::normalize_atom_name(atom.name());
+            const bool donor = AtomCapacity::get_donor_capacity(code, name) > 0;
+            const bool acceptor = AtomCapacity::get_acceptor_capacity(code, name) > 0;
+            if ((donor || acceptor) && !normal_computed) {
+                base_normal = SlotPredictor::compute_base_normal(*residue);
+                normal_computed = true;
+            }
+            if (donor) {
+                entry.h_begin = static_cast<uint32_t>(h_directions_.size());
+                for (const auto& slot : SlotPredictor::predict_h_slots(base_type, name, *residue, base_normal)) {
+                    h_directions_.push_back({to_local * slot.direction(), slot.max_bonds()});
+                    ++entry.h_count;
+                }
+            }
+            if (acceptor) {
+                entry.lp_begin = static_cast<uint32_t>(lp_directions_.size());
+                for (const auto& slot : SlotPredictor::predict_lp_slots(base_type, name, *residue, base_normal)) {
+                    lp_directions_.push_back({to_local * slot.direction(), slot.max_bonds()});
+                    ++entry.lp_count;
+                }
+            }
+            atoms_.push_back(entry);
+        }
+    }
+}
+
+void SlotStore::clear() {
+    release_if_above(residues_, RETAINED_SLOT_LIMIT);
+    release_if_above(atoms_, RETAINED_SLOT_LIMIT);
+    release_if_above(h_directions_, RETAINED_SLOT_LIMIT);
+    release_if_above(lp_directions_, RETAINED_SLOT_LIMIT);
+}
+
+void SlotStore::h_slots(size_t residue_idx, size_t atom_idx, std::vector<HSlot>& out) const {
+    out.clear();
+    const auto& rotation = residues_[residue_idx].rotation;
+    const AtomSlots& entry = atom_slots(residue_idx, atom_idx);
+    for (size_t k = entry.h_begin; k < entry.h_begin + entry.h_count; ++k) {
+        out.emplace_back(rotation * h_directions_[k].local, h_directions_[k].max_bonds);
+    }
+}
+
+void SlotStore::lp_slots(size_t residue_idx, size_t atom_idx, std::vector<LPSlot>& out) const {
+    out.clear();
+    const auto& rotation = residues_[residue_idx].rotation;
+    const AtomSlots& entry = atom_slots(residue_idx, atom_idx);
+    for (size_t k = entry.lp_begin; k < entry.lp_begin + entry.lp_count; ++k) {
+        out.emplace_back(rotation * lp_directions_[k].local, lp_directions_[k].max_bonds);
+    }
+}
+
+} // namespace slot
+} // namespace hydrogen_bond
+} // namespace algorithms
+} // namespace x3dna
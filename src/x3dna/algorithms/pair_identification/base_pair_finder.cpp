@@ -4,13 +4,15 @@
  */
 
 #include <x3dna/algorithms/pair_identification/base_pair_finder.hpp>
+#include <x3dna/algorithms/pair_identification/mutual_best_matcher.hpp>
+#include <x3dna/algorithms/pair_identification/frame_table.hpp>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/core/nucleotide_utils.hpp>
 #include <x3dna/core/chain.hpp>
-#include <x3dna/core/typing/atom_type.hpp>
+#include <x3dna/core/thread_pool.hpp>
 #include <x3dna/io/json_writer.hpp>
-#include <x3dna/geometry/least_squares_fitter.hpp>
 #include <x3dna/geometry/vector3d.hpp>
+#include <x3dna/geometry/spatial_grid.hpp>
 #include <cmath>
 #include <algorithm>
 #include <limits>
@@ -48,20 +50,11 @@ namespace x3dna {
 namespace algorithms {
 
 using namespace x3dna::core;
-using core::AtomType;
-using core::RING_ATOM_TYPES;
-using core::NUM_RING_ATOM_TYPES;
 
 // ============================================================================
 // Helper methods - small, focused functions
 // ============================================================================
 
-bool BasePairFinder::can_participate_in_pairing(const Residue* res) {
-    if (!res)
-        return false;
-    return is_nucleotide(*res) && res->reference_frame().has_value();
-}
-
 bool BasePairFinder::is_matched(int legacy_idx, const std::vector<bool>& matched) {
     if (legacy_idx < 0 || legacy_idx >= static_cast<int>(matched.size())) {
         return false;
@@ -70,7 +63,7 @@ bool BasePairFinder::is_matched(int legacy_idx, const std::vector<bool>& matched
 }
 
 double BasePairFinder::calculate_adjusted_score(const ValidationResult& result, int bp_type_id) const {
-    double quality_adjustment = adjust_pair_quality(result.hbonds);
+    double quality_adjustment = adjust_pair_quality(result.num_good_hb);
     double score = result.quality_score + quality_adjustment;
 
     // Watson-Crick pairs get a bonus (lower is better)
@@ -102,8 +95,7 @@ std::vector<BasePair> BasePairFinder::find_pairs_with_recording(Structure& struc
     return {};
 }
 
-bool BasePairFinder::try_select_mutual_pair(int legacy_idx1, int legacy_idx2, const Residue* res1, const Residue* res2,
-                                            const ValidationResult& result, const PartnerSearchContext& ctx,
+bool BasePairFinder::try_select_mutual_pair(int legacy_idx1, int legacy_idx2, const PartnerSearchContext& ctx,
                                             PairSelectionState& state) const {
     // Verify pair is valid in Phase 1 results
     const auto* phase1_result = ctx.phase1.get_result(legacy_idx1, legacy_idx2);
@@ -120,9 +112,16 @@ bool BasePairFinder::try_select_mutual_pair(int legacy_idx1, int legacy_idx2, co
         return false;
     }
 
-    // Create and store the pair
+    const Residue* res1 = ctx.mapping.get(legacy_idx1);
+    const Residue* res2 = ctx.mapping.get(legacy_idx2);
+    if (!res1 || !res2) {
+        return false;
+    }
+
+    // Create and store the pair; its H-bond list is built only now, from the Phase 1 result
     state.mark_matched(legacy_idx1, legacy_idx2);
-    state.base_pairs.push_back(create_base_pair(legacy_idx1, legacy_idx2, res1, res2, result));
+    state.base_pairs.push_back(
+        create_base_pair(legacy_idx1, legacy_idx2, res1, res2, *phase1_result, ctx.phase1.hbond_detail));
     state.selected_pairs_legacy_idx.push_back({static_cast<size_t>(legacy_idx1), static_cast<size_t>(legacy_idx2)});
     state.pairs_found_this_iteration.push_back({legacy_idx1, legacy_idx2});
 
@@ -141,7 +140,9 @@ std::vector<BasePair> BasePairFinder::find_best_pairs(Structure& structure, io::
 
     ResidueIndexMapping mapping = [&]() {
         ScopedTimer t("Build residue mapping", g_profile_pair_finding);
-        return build_residue_index_mapping(structure);
+        NucleotideEligibility eligibility;
+        eligibility.build(structure, num_threads_);
+        return build_residue_index_mapping(structure, eligibility);
     }();
 
     if (mapping.empty()) {
@@ -149,27 +150,69 @@ std::vector<BasePair> BasePairFinder::find_best_pairs(Structure& structure, io::
     }
 
     if (g_profile_pair_finding) {
-        std::cout << "[PAIR_TIMING] Nucleotide count: " << mapping.by_legacy_idx.size()
+        std::cout << "[PAIR_TIMING] Nucleotide count: " << mapping.num_residues
                   << ", max_legacy_idx: " << mapping.max_legacy_idx << "\n";
     }
 
     Phase1Results phase1 = [&]() {
         ScopedTimer t("Phase 1 validation", g_profile_pair_finding);
-        return run_phase1_validation(mapping);
+        // With a writer attached every result is kept complete for recording, since the writer
+        // records nearly every valid pair. Otherwise validation stops at the first failed check
+        // and keeps only the H-bond count scoring needs; selected pairs detect their H-bonds later.
+        if (writer) {
+            return run_phase1_validation(mapping, ValidationMode::FULL, HBondDetail::LIST);
+        }
+        return run_phase1_validation(mapping, ValidationMode::SHORT_CIRCUIT, HBondDetail::SUMMARY);
     }();
 
     if (g_profile_pair_finding) {
-        std::cout << "[PAIR_TIMING] Phase 1 pairs validated: " << phase1.validation_results.size() << "\n";
+        std::cout << "[PAIR_TIMING] Phase 1 pairs validated: " << phase1.candidates.size() << "\n";
     }
 
     PairSelectionState state(mapping.max_legacy_idx);
     PartnerSearchContext ctx{state.matched_indices, mapping, phase1, writer};
 
     int iteration_num = 0;
-    size_t prev_matched = 0;
-
     auto iteration_start = std::chrono::high_resolution_clock::now();
 
+    if (!writer) {
+        // Nothing to record per iteration: use the incremental matcher, which selects the same
+        // pairs in the same order without rescanning every residue each pass
+        MutualBestMatcher matcher(phase1.candidates);
+        for (const auto& match : matcher.run()) {
+            (void)try_select_mutual_pair(match.legacy_idx1, match.legacy_idx2, ctx, state);
+        }
+        iteration_num = matcher.num_passes();
+    } else {
+        iteration_num = run_recorded_selection(mapping, ctx, state, writer);
+    }
+
+    if (g_profile_pair_finding) {
+        auto iteration_end = std::chrono::high_resolution_clock::now();
+        auto ms = std::chrono::duration<double, std::milli>(iteration_end - iteration_start).count();
+        std::cout << "[PAIR_TIMING] Mutual best matching      " << std::fixed << std::setprecision(1) << ms << " ms"
+                  << " (" << iteration_num << " iterations, " << state.base_pairs.size() << " pairs found)\n";
+    }
+
+    // Record final results
+    if (writer) {
+        if (!state.selected_pairs_legacy_idx.empty()) {
+            writer->record_find_bestpair_selection(state.selected_pairs_legacy_idx);
+        }
+        for (const auto& pair : state.base_pairs) {
+            writer->record_base_pair(pair);
+        }
+    }
+
+    // state is a local struct, so its member is not moved implicitly
+    return std::move(state.base_pairs);
+}
+
+int BasePairFinder::run_recorded_selection(const ResidueIndexMapping& mapping, const PartnerSearchContext& ctx,
+                                           PairSelectionState& state, io::JsonWriter* writer) const {
+    int iteration_num = 0;
+    size_t prev_matched = 0;
+
     // Iterate until no new pairs found
     do {
         iteration_num++;
@@ -180,61 +223,35 @@ std::vector<BasePair> BasePairFinder::find_best_pairs(Structure& structure, io::
             if (is_matched(idx1, state.matched_indices))
                 continue;
 
-            const Residue* res1 = mapping.get(idx1);
-            if (!can_participate_in_pairing(res1))
+            if (!mapping.is_pairable(idx1))
                 continue;
 
-            auto best = find_best_partner(idx1, ctx);
-            if (!best.has_value())
+            const CandidateEntry* best = find_best_partner(idx1, ctx);
+            if (!best)
                 continue;
 
-            int idx2 = best->first;
-            const ValidationResult& result = best->second;
+            int idx2 = best->partner;
 
             // Check for mutual best match
-            auto reverse = find_best_partner(idx2, ctx);
-            const bool is_mutual = reverse.has_value() && reverse->first == idx1;
+            const CandidateEntry* reverse = find_best_partner(idx2, ctx);
+            const bool is_mutual = reverse && reverse->partner == idx1;
 
             if (is_mutual) {
-                const Residue* res2 = mapping.get(idx2);
-                if (res2) {
-                    (void)try_select_mutual_pair(idx1, idx2, res1, res2, result, ctx, state);
-                }
+                (void)try_select_mutual_pair(idx1, idx2, ctx, state);
             }
 
             // Record decision for JSON output
-            if (writer) {
-                int best_j_for_i = idx2;
-                int best_i_for_j = reverse.has_value() ? reverse->first : 0;
-                writer->record_mutual_best_decision(idx1, idx2, best_j_for_i, best_i_for_j, is_mutual, is_mutual);
-            }
+            int best_j_for_i = idx2;
+            int best_i_for_j = reverse ? reverse->partner : 0;
+            writer->record_mutual_best_decision(idx1, idx2, best_j_for_i, best_i_for_j, is_mutual, is_mutual);
         }
 
-        if (writer) {
-            writer->record_iteration_state(iteration_num, static_cast<int>(state.count_matched()),
-                                           mapping.max_legacy_idx, state.matched_indices,
-                                           state.pairs_found_this_iteration);
-        }
+        writer->record_iteration_state(iteration_num, static_cast<int>(state.count_matched()),
+                                       mapping.max_legacy_idx, state.matched_indices,
+                                       state.pairs_found_this_iteration);
     } while (state.count_matched() > prev_matched);
 
-    if (g_profile_pair_finding) {
-        auto iteration_end = std::chrono::high_resolution_clock::now();
-        auto ms = std::chrono::duration<double, std::milli>(iteration_end - iteration_start).count();
-        std::cout << "[PAIR_TIMING] Mutual best matching      " << std::fixed << std::setprecision(1) << ms << " ms"
-                  << " (" << iteration_num << " iterations, " << state.base_pairs.size() << " pairs found)\n";
-    }
-
-    // Record final results
-    if (writer) {
-        if (!state.selected_pairs_legacy_idx.empty()) {
-            writer->record_find_bestpair_selection(state.selected_pairs_legacy_idx);
-        }
-        for (const auto& pair : state.base_pairs) {
-            writer->record_base_pair(pair);
-        }
-    }
-
-    return state.base_pairs;
+    return iteration_num;
 }
 
 std::vector<BasePair> BasePairFinder::find_all_pairs(const Structure& structure) const {
@@ -244,22 +261,35 @@ std::vector<BasePair> BasePairFinder::find_all_pairs(const Structure& structure)
     std::vector<std::pair<size_t, const Residue*>> nucleotide_residues;
     size_t global_idx = 0;
 
+    NucleotideEligibility eligibility;
+    eligibility.build(structure, num_threads_);
+
     for (const auto& chain : structure.chains()) {
         for (const auto& residue : chain.residues()) {
-            if (is_nucleotide(residue) && residue.reference_frame().has_value()) {
+            const bool is_nt = residue.legacy_residue_idx() > 0 ? eligibility.is_nucleotide(residue.legacy_residue_idx())
+                                                                : is_nucleotide(residue);
+            if (is_nt && residue.reference_frame().has_value()) {
                 nucleotide_residues.push_back({global_idx, &residue});
             }
             global_idx++;
         }
     }
 
+    std::vector<const Residue*> residues;
+    residues.reserve(nucleotide_residues.size());
+    for (const auto& entry : nucleotide_residues) {
+        residues.push_back(entry.second);
+    }
+    const PreparedResidues prepared = validator_.prepare(std::move(residues));
+
     // Check all pairs
     for (size_t i = 0; i < nucleotide_residues.size(); ++i) {
         for (size_t j = i + 1; j < nucleotide_residues.size(); ++j) {
             const auto& [idx1, res1] = nucleotide_residues[i];
             const auto& [idx2, res2] = nucleotide_residues[j];
 
-            ValidationResult result = validator_.validate(*res1, *res2);
+            // Only valid pairs are kept, so validation can stop at the first failed check
+            ValidationResult result = validator_.validate(prepared[i], prepared[j], ValidationMode::SHORT_CIRCUIT);
 
             if (result.is_valid) {
                 // Validation already ensures both residues have frames, so we can access them directly
@@ -272,7 +302,7 @@ std::vector<BasePair> BasePairFinder::find_all_pairs(const Structure& structure)
                 pair.set_res_id1(res1->res_id());
                 pair.set_res_id2(res2->res_id());
 
-                pair.set_hydrogen_bonds(result.hbonds);
+                pair.set_hydrogen_bonds(std::move(result.hbonds));
 
                 // Set bp_type string
                 char base1 = core::one_letter_code(*res1);
@@ -281,7 +311,7 @@ std::vector<BasePair> BasePairFinder::find_all_pairs(const Structure& structure)
                     pair.set_bp_type(std::string(1, base1) + std::string(1, base2));
                 }
 
-                base_pairs.push_back(pair);
+                base_pairs.push_back(std::move(pair));
             }
         }
     }
@@ -289,98 +319,72 @@ std::vector<BasePair> BasePairFinder::find_all_pairs(const Structure& structure)
     return base_pairs;
 }
 
-std::optional<std::pair<int, ValidationResult>> BasePairFinder::find_best_partner(
-    int legacy_idx1, const PartnerSearchContext& ctx) const {
-
-    const Residue* res1 = ctx.mapping.get(legacy_idx1);
-    if (!can_participate_in_pairing(res1)) {
-        return std::nullopt;
+const CandidateEntry* BasePairFinder::find_best_partner(int legacy_idx1, const PartnerSearchContext& ctx) const {
+    if (!ctx.mapping.is_pairable(legacy_idx1)) {
+        return nullptr;
     }
 
-    // Early rejection threshold (squared to avoid sqrt)
-    const double max_origin_distance_sq = validator_.parameters().max_dorg * validator_.parameters().max_dorg;
-    const auto& origin1 = res1->reference_frame()->origin();
-
+    // Phase 1 candidates of legacy_idx1: every pairable residue within max_dorg, sorted by index,
+    // with bp_type_id and selection score precomputed
+    const auto row = ctx.phase1.candidates.row(legacy_idx1);
     double best_score = std::numeric_limits<double>::max();
-    std::optional<std::pair<int, ValidationResult>> best_result;
-    std::vector<std::tuple<int, bool, double, int>> candidates;
-    const bool collect = (ctx.writer != nullptr);
-
-    for (int idx2 = 1; idx2 <= ctx.mapping.max_legacy_idx; ++idx2) {
-        // Skip self or already matched
-        if (idx2 == legacy_idx1 || is_matched(idx2, ctx.matched_indices)) {
-            if (collect)
-                candidates.emplace_back(idx2, false, std::numeric_limits<double>::max(), 0);
-            continue;
-        }
+    const CandidateEntry* best_entry = nullptr;
 
-        const Residue* res2 = ctx.mapping.get(idx2);
-        if (!can_participate_in_pairing(res2)) {
-            if (collect)
-                candidates.emplace_back(idx2, false, std::numeric_limits<double>::max(), 0);
-            continue;
+    if (!ctx.writer) {
+        for (const auto& entry : row) {
+            if (!entry.is_valid || is_matched(entry.partner, ctx.matched_indices)) {
+                continue;
+            }
+            if (entry.score < best_score) {
+                best_score = entry.score;
+                best_entry = &entry;
+            }
         }
+    } else {
+        // Recording lists every legacy index (as legacy find_bestpair does), so walk the
+        // full index range alongside the sorted candidate row
+        std::vector<std::tuple<int, bool, double, int>> candidates;
+        candidates.reserve(static_cast<size_t>(ctx.mapping.max_legacy_idx));
+        const CandidateEntry* cursor = row.begin();
+
+        for (int idx2 = 1; idx2 <= ctx.mapping.max_legacy_idx; ++idx2) {
+            while (cursor != row.end() && cursor->partner < idx2) {
+                ++cursor;
+            }
+            const bool is_candidate = (cursor != row.end() && cursor->partner == idx2);
 
-        // Early distance rejection - skip pairs that are too far apart
-        const auto& origin2 = res2->reference_frame()->origin();
-        double dx = origin2.x() - origin1.x();
-        double dy = origin2.y() - origin1.y();
-        double dz = origin2.z() - origin1.z();
-        double dist_sq = dx * dx + dy * dy + dz * dz;
-
-        if (dist_sq > max_origin_distance_sq) {
-            if (collect)
+            // Skip self, already matched, non-pairable or too far apart
+            if (idx2 == legacy_idx1 || is_matched(idx2, ctx.matched_indices) || !is_candidate) {
                 candidates.emplace_back(idx2, false, std::numeric_limits<double>::max(), 0);
-            continue;  // Skip - too far apart
-        }
-
-        // Get validation result from Phase 1 or compute on the fly
-        const auto* phase1_result = ctx.phase1.get_result(legacy_idx1, idx2);
-        ValidationResult fallback_result; // Stays in scope for the loop iteration
-
-        if (!phase1_result) {
-            fallback_result = (legacy_idx1 < idx2) ? validator_.validate(*res1, *res2)
-                                                   : validator_.validate(*res2, *res1);
-            phase1_result = &fallback_result;
-        }
+                continue;
+            }
 
-        const ValidationResult& result = *phase1_result;
-        if (!result.is_valid) {
-            if (collect)
+            const CandidateEntry& entry = *cursor;
+            if (!entry.is_valid) {
                 candidates.emplace_back(idx2, true, std::numeric_limits<double>::max(), 0);
-            continue;
-        }
-
-        // Record validation for JSON output
-        if (ctx.writer && legacy_idx1 < idx2) {
-            record_validation_results(legacy_idx1, idx2, res1, res2, result, ctx.writer);
-        }
+                continue;
+            }
 
-        // Calculate score
-        int bp_type_id = ctx.phase1.get_bp_type_id(legacy_idx1, idx2);
-        if (bp_type_id == 0) {
-            double adj_score = result.quality_score + adjust_pair_quality(result.hbonds);
-            bp_type_id = calculate_bp_type_id(res1, res2, result, adj_score);
-        }
-        double score = calculate_adjusted_score(result, bp_type_id);
+            // Record validation for JSON output
+            if (legacy_idx1 < idx2) {
+                record_validation_results(legacy_idx1, idx2, ctx.mapping.get(legacy_idx1), ctx.mapping.get(idx2),
+                                          ctx.phase1.candidates.info(entry).validation, ctx.writer);
+            }
 
-        if (collect) {
-            candidates.emplace_back(idx2, true, score, bp_type_id);
-        }
+            candidates.emplace_back(idx2, true, entry.score, entry.bp_type_id);
 
-        if (score < best_score) {
-            best_score = score;
-            best_result = std::make_pair(idx2, result);
+            if (entry.score < best_score) {
+                best_score = entry.score;
+                best_entry = &entry;
+            }
         }
-    }
 
-    if (ctx.writer && collect) {
-        int best_j = best_result.has_value() ? best_result->first : 0;
-        double final_score = (best_score < std::numeric_limits<double>::max()) ? best_score : 0.0;
+        int best_j = best_entry ? best_entry->partner : 0;
+        double final_score = best_entry ? best_score : 0.0;
         ctx.writer->record_best_partner_candidates(legacy_idx1, candidates, best_j, final_score);
     }
 
-    return best_result;
+    return best_entry;
 }
 
 void BasePairFinder::record_validation_results(int legacy_idx1, int legacy_idx2, const core::Residue* res1,
@@ -398,7 +402,7 @@ void BasePairFinder::record_validation_results(int legacy_idx1, int legacy_idx2,
         size_t base_j = static_cast<size_t>(legacy_idx2 - 1); // Convert to 0-based
 
         // Adjust quality_score using adjust_pairQuality (matches legacy)
-        double quality_adjustment = adjust_pair_quality(result.hbonds);
+        double quality_adjustment = adjust_pair_quality(result.num_good_hb);
         double adjusted_quality_score = result.quality_score + quality_adjustment;
 
         // Prepare rtn_val array: [dorg, d_v, plane_angle, dNN, quality_score]
@@ -466,9 +470,9 @@ void BasePairFinder::record_validation_results(int legacy_idx1, int legacy_idx2,
     }
 }
 
-double BasePairFinder::adjust_pair_quality(const std::vector<core::hydrogen_bond>& hbonds) const {
+double BasePairFinder::adjust_pair_quality(int num_good_hb) const {
     // Delegate to QualityScoreCalculator
-    return quality_calculator_.adjust_pair_quality(hbonds);
+    return quality_calculator_.adjust_pair_quality(num_good_hb);
 }
 
 int BasePairFinder::calculate_bp_type_id(const Residue* res1, const Residue* res2, const ValidationResult& result,
@@ -477,157 +481,8 @@ int BasePairFinder::calculate_bp_type_id(const Residue* res1, const Residue* res
     return quality_calculator_.calculate_bp_type_id(*res1, *res2, result);
 }
 
-namespace {
-// Standard nucleotide ring geometry (from legacy xyz_ring array)
-// Matches RA_LIST order: " C4 ", " N3 ", " C2 ", " N1 ", " C6 ", " C5 ", " N7 ", " C8 ", " N9 "
-constexpr std::array<std::array<double, 3>, 9> STANDARD_RING_GEOMETRY = {{
-    {{-1.265, 3.177, 0.000}}, // C4
-    {{-2.342, 2.364, 0.001}}, // N3
-    {{-1.999, 1.087, 0.000}}, // C2
-    {{-0.700, 0.641, 0.000}}, // N1
-    {{0.424, 1.460, 0.000}},  // C6
-    {{0.071, 2.833, 0.000}},  // C5
-    {{0.870, 3.969, 0.000}},  // N7 (purine)
-    {{0.023, 4.962, 0.000}},  // C8 (purine)
-    {{-1.289, 4.551, 0.000}}, // N9 (purine)
-}};
-
-// Legacy RA_LIST order for ring atoms (using trimmed names)
-// Ring atom names array removed - now using RING_ATOM_TYPES from atom_type.hpp
-
-// Use constant from validation_constants.hpp
-using validation_constants::NT_RMSD_CUTOFF;
-
-/**
- * @brief Check nucleotide type by RMSD (matches legacy check_nt_type_by_rmsd)
- * @param residue Residue to check
- * @return RMSD value if calculable, or RMSD_DUMMY if not enough atoms
- */
-std::optional<double> check_nt_type_by_rmsd(const Residue& residue) {
-    // Find ring atoms in residue using AtomType for O(1) comparison
-    std::vector<geometry::Vector3D> experimental_coords;
-    std::vector<geometry::Vector3D> standard_coords;
-    int nN = 0; // Count of nitrogen atoms (N1, N3, N7, N9)
-    bool has_c1_prime = false;
-
-    // LEGACY BEHAVIOR: Try ALL 9 ring atoms first (matches legacy residue_ident)
-    for (size_t i = 0; i < NUM_RING_ATOM_TYPES; ++i) {
-        AtomType target_type = RING_ATOM_TYPES[i];
-        const Atom* atom = residue.find_atom_by_type(target_type);
-        if (atom != nullptr) {
-            const auto& pos = atom->position();
-            experimental_coords.push_back(geometry::Vector3D(pos.x(), pos.y(), pos.z()));
-
-            // Use corresponding standard geometry
-            standard_coords.push_back(geometry::Vector3D(STANDARD_RING_GEOMETRY[i][0], STANDARD_RING_GEOMETRY[i][1],
-                                                         STANDARD_RING_GEOMETRY[i][2]));
-
-            // Count nitrogen atoms (indices 1=N3, 3=N1, 6=N7, 8=N9)
-            if (i == 1 || i == 3 || i == 6 || i == 8) {
-                nN++;
-            }
-        }
-    }
-
-    // Check for C1' using AtomType, or C1R via string (alternative name)
-    if (residue.has_atom_type(AtomType::C1_PRIME)) {
-        has_c1_prime = true;
-    } else {
-        for (const auto& atom : residue.atoms()) {
-            if (atom.name() == "C1R") {
-                has_c1_prime = true;
-                break;
-            }
-        }
-    }
-
-    // Legacy requires: (!nN && !C1_prime) -> return DUMMY
-    if (nN == 0 && !has_c1_prime) {
-        return std::nullopt; // DUMMY
-    }
-
-    // Need at least 3 atoms for RMSD calculation
-    if (experimental_coords.size() < 3) {
-        return std::nullopt; // DUMMY
-    }
-
-    // Perform least-squares fitting (matches legacy ls_fitting)
-    geometry::LeastSquaresFitter fitter;
-    try {
-        auto fit_result = fitter.fit(standard_coords, experimental_coords);
-        return fit_result.rms;
-    } catch (const std::exception&) {
-        return std::nullopt; // DUMMY
-    }
-}
-
-// Additional helpers for is_nucleotide using AtomType
-
-// Common ring atom types (pyrimidine ring)
-constexpr std::array<AtomType, 6> COMMON_RING_ATOM_TYPES = {
-    AtomType::C4, AtomType::N3, AtomType::C2, AtomType::N1, AtomType::C6, AtomType::C5
-};
-// Purine-only ring atom types
-constexpr std::array<AtomType, 3> PURINE_RING_ATOM_TYPES = {AtomType::N7, AtomType::C8, AtomType::N9};
-
-bool is_standard_nucleotide(core::typing::BaseType type) {
-    return type == core::typing::BaseType::ADENINE || type == core::typing::BaseType::CYTOSINE ||
-           type == core::typing::BaseType::GUANINE || type == core::typing::BaseType::THYMINE ||
-           type == core::typing::BaseType::URACIL;
-}
-
-bool is_recognized_modified_nucleotide(core::typing::BaseType type) {
-    return type == core::typing::BaseType::PSEUDOURIDINE || type == core::typing::BaseType::INOSINE;
-}
-
-bool needs_rmsd_validation(const Residue& residue) {
-    auto mol_type = residue.molecule_type();
-    auto base_type = residue.base_type();
-    return mol_type == core::typing::MoleculeType::UNKNOWN ||
-           (mol_type == core::typing::MoleculeType::NUCLEIC_ACID && base_type == core::typing::BaseType::UNKNOWN);
-}
-
-// Count matching atoms using AtomType array
-template <size_t N> int count_matching_atom_types(const Residue& residue, const std::array<AtomType, N>& atom_types) {
-    int count = 0;
-    for (auto type : atom_types) {
-        if (residue.has_atom_type(type))
-            count++;
-    }
-    return count;
-}
-
-bool passes_rmsd_nucleotide_check(const Residue& residue) {
-    const int common_count = count_matching_atom_types(residue, COMMON_RING_ATOM_TYPES);
-    const int purine_count = count_matching_atom_types(residue, PURINE_RING_ATOM_TYPES);
-    const int total_ring_atoms = common_count + purine_count;
-
-    if (total_ring_atoms < 3)
-        return false;
-
-    auto rmsd = check_nt_type_by_rmsd(residue);
-    return rmsd.has_value() && *rmsd <= NT_RMSD_CUTOFF;
-}
-
-} // namespace
-
 bool BasePairFinder::is_nucleotide(const Residue& residue) {
-    const auto base_type = residue.base_type();
-
-    // Standard nucleotides (A, C, G, T, U)
-    if (is_standard_nucleotide(base_type))
-        return true;
-
-    // Explicitly recognized modified nucleotides
-    if (is_recognized_modified_nucleotide(base_type))
-        return true;
-
-    // Unknown or noncanonical residues need RMSD validation
-    if (needs_rmsd_validation(residue)) {
-        return passes_rmsd_nucleotide_check(residue);
-    }
-
-    return false;
+    return NucleotideEligibility::classify(residue);
 }
 
 size_t BasePairFinder::get_residue_index(const Structure& structure, const Residue& residue) {
@@ -643,13 +498,20 @@ size_t BasePairFinder::get_residue_index(const Structure& structure, const Resid
     return idx;
 }
 
-BasePairFinder::ResidueIndexMapping BasePairFinder::build_residue_index_mapping(const Structure& structure) const {
+BasePairFinder::ResidueIndexMapping BasePairFinder::build_residue_index_mapping(
+    const Structure& structure, const NucleotideEligibility& eligibility) const {
     ResidueIndexMapping mapping;
 
     for (const auto& chain : structure.chains()) {
         for (const auto& residue : chain.residues()) {
             int legacy_idx = residue.legacy_residue_idx();
             if (legacy_idx > 0) {
+                if (legacy_idx >= static_cast<int>(mapping.by_legacy_idx.size())) {
+                    mapping.by_legacy_idx.resize(static_cast<size_t>(legacy_idx) + 1, nullptr);
+                }
+                if (!mapping.by_legacy_idx[legacy_idx]) {
+                    mapping.num_residues++;
+                }
                 mapping.by_legacy_idx[legacy_idx] = &residue;
                 if (legacy_idx > mapping.max_legacy_idx) {
                     mapping.max_legacy_idx = legacy_idx;
@@ -658,71 +520,155 @@ BasePairFinder::ResidueIndexMapping BasePairFinder::build_residue_index_mapping(
         }
     }
 
+    // Pairable = nucleotide with a reference frame; fixed for the rest of the search
+    mapping.pairable.assign(mapping.by_legacy_idx.size(), false);
+    for (size_t idx = 1; idx < mapping.by_legacy_idx.size(); ++idx) {
+        const Residue* res = mapping.by_legacy_idx[idx];
+        mapping.pairable[idx] = res && eligibility.is_nucleotide(static_cast<int>(idx)) &&
+                                res->reference_frame().has_value();
+    }
+
     return mapping;
 }
 
-BasePairFinder::Phase1Results BasePairFinder::run_phase1_validation(const ResidueIndexMapping& mapping) const {
+BasePairFinder::Phase1Results BasePairFinder::run_phase1_validation(const ResidueIndexMapping& mapping,
+                                                                    ValidationMode mode,
+                                                                    HBondDetail hbond_detail) const {
     Phase1Results results;
-
-    // Early rejection threshold - pairs with origin distance > this are skipped
-    // This matches max_dorg in ValidationParameters (default 15.0)
-    const double max_origin_distance_sq = validator_.parameters().max_dorg * validator_.parameters().max_dorg;
-
-    for (int legacy_idx1 = 1; legacy_idx1 <= mapping.max_legacy_idx - 1; ++legacy_idx1) {
-        auto it1 = mapping.by_legacy_idx.find(legacy_idx1);
-        if (it1 == mapping.by_legacy_idx.end() || !it1->second) {
+    results.hbond_detail = hbond_detail;
+    results.candidates.reset(mapping.max_legacy_idx);
+
+    // Residues that can pair, in ascending legacy order
+    std::vector<int> eligible_idx;
+    std::vector<const Residue*> eligible_res;
+    for (int legacy_idx = 1; legacy_idx <= mapping.max_legacy_idx; ++legacy_idx) {
+        if (!mapping.is_pairable(legacy_idx)) {
             continue;
         }
-        const Residue* res1 = it1->second;
-        if (!is_nucleotide(*res1) || !res1->reference_frame().has_value()) {
-            continue;
+        eligible_idx.push_back(legacy_idx);
+        eligible_res.push_back(mapping.get(legacy_idx));
+    }
+
+    // Frames copied once into contiguous arrays for the batch prefilter
+    FrameTable frames;
+    frames.build(eligible_res);
+
+    // Ring and H-bond atom data computed once per residue, shared read-only by all rows
+    const PreparedResidues prepared = validator_.prepare(eligible_res);
+
+    const ValidationParameters& params = validator_.parameters();
+    const double max_dorg = params.max_dorg;
+    const size_t n = eligible_idx.size();
+
+    // Cell list over origins: only residues in neighboring cells can be within max_dorg.
+    // Small structures use the all-pairs scan, which is cheaper than building a grid.
+    std::optional<geometry::SpatialGrid> grid;
+    if (n >= SPATIAL_GRID_MIN_RESIDUES && max_dorg > 0.0 && std::isfinite(max_dorg)) {
+        std::vector<geometry::Vector3D> origins(n);
+        for (size_t i = 0; i < n; ++i) {
+            origins[i] = frames.origin(i);
         }
+        grid.emplace(origins, max_dorg);
+    }
 
-        // Cache origin for res1 to avoid repeated access
-        const auto& origin1 = res1->reference_frame()->origin();
+    // Per-thread buffers for one row
+    struct RowScratch {
+        std::vector<size_t> partners;
+        std::vector<FrameTable::PairGeometry> geometry;
+    };
 
-        for (int legacy_idx2 = legacy_idx1 + 1; legacy_idx2 <= mapping.max_legacy_idx; ++legacy_idx2) {
-            auto it2 = mapping.by_legacy_idx.find(legacy_idx2);
-            if (it2 == mapping.by_legacy_idx.end() || !it2->second) {
-                continue;
-            }
-            const Residue* res2 = it2->second;
-            if (!is_nucleotide(*res2) || !res2->reference_frame().has_value()) {
-                continue;
+    // Validate residue i against every j > i within max_dorg, in ascending j (legacy check_pair order)
+    auto validate_row = [&](size_t i, RowScratch& scratch, auto&& emit) {
+        auto& partners = scratch.partners;
+        partners.clear();
+        if (grid) {
+            grid->candidates_near(frames.origin(i), partners);
+            partners.erase(std::remove_if(partners.begin(), partners.end(), [i](size_t j) { return j <= i; }),
+                           partners.end());
+            std::sort(partners.begin(), partners.end());
+        } else {
+            for (size_t j = i + 1; j < n; ++j) {
+                partners.push_back(j);
             }
+        }
 
-            // Early distance rejection - skip pairs that are too far apart
-            // Uses squared distance to avoid sqrt overhead
-            const auto& origin2 = res2->reference_frame()->origin();
-            double dx = origin2.x() - origin1.x();
-            double dy = origin2.y() - origin1.y();
-            double dz = origin2.z() - origin1.z();
-            double dist_sq = dx * dx + dy * dy + dz * dz;
+        // Frame-only checks for the whole row first; only candidates that survive them pay for
+        // the overlap and H-bond checks in validate()
+        scratch.geometry.resize(partners.size());
+        frames.prefilter(i, partners.data(), partners.size(), params, scratch.geometry.data());
 
-            if (dist_sq > max_origin_distance_sq) {
-                continue;  // Skip - too far apart to form a base pair
+        for (size_t k = 0; k < partners.size(); ++k) {
+            const size_t j = partners[k];
+            const FrameTable::PairGeometry& geometry = scratch.geometry[k];
+            if (geometry.screen == FrameTable::Screen::OUT_OF_RANGE) {
+                continue; // Skip - too far apart to form a base pair
             }
 
-            // Validate pair
-            ValidationResult result = validator_.validate(*res1, *res2);
+            ValidationResult result = geometry.screen == FrameTable::Screen::REJECTED
+                                          ? FrameTable::rejected_result(geometry, params)
+                                          : validator_.validate(prepared[i], prepared[j], mode, hbond_detail);
+
+            // Calculate bp_type_id and the selection score once, so partner search never recomputes them
+            double adjusted_quality_score = result.quality_score + adjust_pair_quality(result.num_good_hb);
+            int bp_type_id = calculate_bp_type_id(eligible_res[i], eligible_res[j], result, adjusted_quality_score);
+            double score = result.is_valid ? calculate_adjusted_score(result, bp_type_id)
+                                           : std::numeric_limits<double>::max();
 
             // Store validation result (normalized by index order)
-            std::pair<int, int> normalized_pair = std::make_pair(legacy_idx1, legacy_idx2);
-            results.validation_results[normalized_pair] = result;
-
-            // Calculate and store bp_type_id
-            double quality_adjustment = adjust_pair_quality(result.hbonds);
-            double adjusted_quality_score = result.quality_score + quality_adjustment;
-            int bp_type_id = calculate_bp_type_id(res1, res2, result, adjusted_quality_score);
-            results.bp_type_ids[normalized_pair] = bp_type_id;
+            emit(eligible_idx[i], eligible_idx[j],
+                 CandidateInfo{std::move(result), bp_type_id, adjusted_quality_score}, score);
         }
+    };
+
+    const size_t num_threads = core::ThreadPool::resolve_thread_count(num_threads_);
+    if (num_threads <= 1 || n < 2 * PHASE1_ROWS_PER_TASK) {
+        RowScratch scratch;
+        auto add = [&results](int idx1, int idx2, CandidateInfo&& info, double score) {
+            results.candidates.add(idx1, idx2, std::move(info), score);
+        };
+        for (size_t i = 0; i + 1 < n; ++i) {
+            validate_row(i, scratch, add);
+        }
+        results.candidates.finalize();
+        return results;
     }
 
+    // Parallel: each task validates a block of rows into its own buffer; buffers are merged in
+    // task order so the table (and everything derived from it) matches the serial run exactly.
+    struct PendingCandidate {
+        int idx1;
+        int idx2;
+        CandidateInfo info;
+        double score;
+    };
+    const size_t num_tasks = (n + PHASE1_ROWS_PER_TASK - 1) / PHASE1_ROWS_PER_TASK;
+    std::vector<std::vector<PendingCandidate>> task_results(num_tasks);
+
+    core::ThreadPool pool(std::min(num_threads, num_tasks));
+    std::vector<RowScratch> scratch(pool.num_threads());
+
+    pool.parallel_for(num_tasks, [&](size_t task, size_t worker) {
+        auto& out = task_results[task];
+        auto emit = [&out](int idx1, int idx2, CandidateInfo&& info, double score) {
+            out.push_back({idx1, idx2, std::move(info), score});
+        };
+        const size_t end = std::min(n, (task + 1) * PHASE1_ROWS_PER_TASK);
+        for (size_t i = task * PHASE1_ROWS_PER_TASK; i < end; ++i) {
+            validate_row(i, scratch[worker], emit);
+        }
+    });
+
+    for (auto& task_out : task_results) {
+        for (auto& pending : task_out) {
+            results.candidates.add(pending.idx1, pending.idx2, std::move(pending.info), pending.score);
+        }
+    }
+    results.candidates.finalize();
     return results;
 }
 
 BasePair BasePairFinder::create_base_pair(int legacy_idx1, int legacy_idx2, const Residue* res1, const Residue* res2,
-                                          const ValidationResult& result) const {
+                                          const ValidationResult& result, HBondDetail hbond_detail) const {
     // ALWAYS store smaller index first for consistency with legacy behavior
     size_t idx_small = static_cast<size_t>(std::min(legacy_idx1, legacy_idx2)) - 1;
     size_t idx_large = static_cast<size_t>(std::max(legacy_idx1, legacy_idx2)) - 1;
@@ -752,8 +698,13 @@ BasePair BasePairFinder::create_base_pair(int legacy_idx1, int legacy_idx2, cons
         pair.set_res_id2(res_large->res_id());
     }
 
-    // Set hydrogen bonds
-    pair.set_hydrogen_bonds(result.hbonds);
+    // Set hydrogen bonds. Phase 1 validated the pair as (smaller index, larger index), so
+    // detecting them now in that order gives the list LIST detail would have stored.
+    if (hbond_detail == HBondDetail::SUMMARY && res_small && res_large) {
+        pair.set_hydrogen_bonds(validator_.find_hydrogen_bonds(*res_small, *res_large));
+    } else {
+        pair.set_hydrogen_bonds(result.hbonds);
+    }
 
     // Determine bp_type string from residue names
     if (res_small && res_large) {
@@ -4,12 +4,14 @@
  */
 
 #include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <x3dna/algorithms/pair_identification/quality_score_calculator.hpp>
 #include <x3dna/algorithms/validation/overlap_calculator.hpp>
 #include <x3dna/core/atom.hpp>
 #include <x3dna/core/typing.hpp>
 #include <x3dna/core/nucleotide_utils.hpp>
 #include <x3dna/algorithms/ring_atom_matcher.hpp>
 #include <x3dna/algorithms/hydrogen_bond.hpp>
+#include <x3dna/algorithms/hydrogen_bond/atom_type_tables.hpp>
 #include <cmath>
 #include <algorithm>
 #include <cstring>
@@ -28,8 +30,25 @@ namespace algorithms {
 using namespace x3dna::core;
 using namespace x3dna::geometry;
 
-ValidationResult BasePairValidator::validate(const Residue& res1, const Residue& res2) const {
+PreparedResidues BasePairValidator::prepare(std::vector<const Residue*> residues) const {
+    PreparedResidues prepared;
+    prepared.residues = std::move(residues);
+    prepared.rings.build(prepared.residues);
+    prepared.hbond_atoms.build(prepared.residues, hbond_detector_);
+    return prepared;
+}
+
+ValidationResult BasePairValidator::validate(const Residue& res1, const Residue& res2, ValidationMode mode,
+                                             HBondDetail hbond_detail) const {
+    const PreparedResidues prepared = prepare({&res1, &res2});
+    return validate(prepared[0], prepared[1], mode, hbond_detail);
+}
+
+ValidationResult BasePairValidator::validate(const PreparedResidue& prepared1, const PreparedResidue& prepared2,
+                                             ValidationMode mode, HBondDetail hbond_detail) const {
     ValidationResult result;
+    const Residue& res1 = prepared1.residue;
+    const Residue& res2 = prepared2.residue;
 
     // Skip if same residue
     if (&res1 == &res2) {
@@ -66,6 +85,19 @@ ValidationResult BasePairValidator::validate(const Residue& res1, const Residue&
     // Calculate plane angle (angle between z-axes, 0-90 degrees)
     result.plane_angle = z1_z2_angle_in_0_to_90(frame1.z_axis(), frame2.z_axis());
 
+    // Calculate quality score (matches rtn_val[5])
+    result.quality_score = result.dorg + validation_constants::D_V_WEIGHT * result.d_v +
+                           result.plane_angle / validation_constants::PLANE_ANGLE_DIVISOR;
+
+    // Frame-only checks are free at this point; dNN, overlap and H-bonds all need atoms
+    const bool short_circuit = (mode == ValidationMode::SHORT_CIRCUIT);
+    result.distance_check = in_range(result.dorg, params_.min_dorg, params_.max_dorg);
+    result.d_v_check = in_range(result.d_v, params_.min_dv, params_.max_dv);
+    result.plane_angle_check = in_range(result.plane_angle, params_.min_plane_angle, params_.max_plane_angle);
+    if (short_circuit && !(result.distance_check && result.d_v_check && result.plane_angle_check)) {
+        return result;
+    }
+
     // Calculate dNN (distance between N1/N9 atoms)
     auto n1_n9_1 = find_n1_n9_position(res1);
     auto n1_n9_2 = find_n1_n9_position(res2);
@@ -76,18 +108,22 @@ ValidationResult BasePairValidator::validate(const Residue& res1, const Residue&
         result.dNN = validation_constants::DNN_FALLBACK; // Large value if N1/N9 not found
     }
 
-    // Calculate quality score (matches rtn_val[5])
-    result.quality_score = result.dorg + validation_constants::D_V_WEIGHT * result.d_v +
-                           result.plane_angle / validation_constants::PLANE_ANGLE_DIVISOR;
-
-    // Perform validation checks
-    result.distance_check = in_range(result.dorg, params_.min_dorg, params_.max_dorg);
-    result.d_v_check = in_range(result.d_v, params_.min_dv, params_.max_dv);
-    result.plane_angle_check = in_range(result.plane_angle, params_.min_plane_angle, params_.max_plane_angle);
     result.dNN_check = in_range(result.dNN, params_.min_dNN, params_.max_dNN);
+    if (short_circuit && !result.dNN_check) {
+        return result;
+    }
+
+    // The H-bond count is much cheaper than the overlap polygons and rejects most
+    // of the pairs left at this point, so short-circuit mode runs it first
+    if (short_circuit) {
+        count_hydrogen_bonds_simple(prepared1, prepared2, result);
+        if (!result.hbond_check) {
+            return result;
+        }
+    }
 
     // Check overlap area
-    result.overlap_area = calculate_overlap_area(res1, res2, oave, zave);
+    result.overlap_area = validation::OverlapCalculator::calculate(prepared1.ring, prepared2.ring, oave, zave);
     result.overlap_check = (result.overlap_area < params_.overlap_threshold);
 
     // If all distance/angle checks pass and overlap is acceptable, check hydrogen bonds
@@ -98,15 +134,8 @@ ValidationResult BasePairValidator::validate(const Residue& res1, const Residue&
     if (cdns) {
         // Count H-bonds simply (BEFORE validation) - matches legacy check_pair behavior
         // This is the key fix: legacy counts H-bonds before validation for pair validation
-        using namespace x3dna::algorithms::hydrogen_bond;
-        HBondDetector detector(HBondDetectionParams::legacy_compatible());
-        detector.count_potential_hbonds(res1, res2, result.num_base_hb, result.num_o2_hb);
-
-        // Check H-bond requirement (matches legacy lines 4616-4617)
-        if (params_.min_base_hb > 0) {
-            result.hbond_check = (result.num_base_hb >= params_.min_base_hb);
-        } else {
-            result.hbond_check = (result.num_o2_hb > 0 || result.num_base_hb > 0);
+        if (!short_circuit) {
+            count_hydrogen_bonds_simple(prepared1, prepared2, result);
         }
 
         // Pair is valid if all checks pass
@@ -114,8 +143,13 @@ ValidationResult BasePairValidator::validate(const Residue& res1, const Residue&
 
         // Find validated H-bonds (AFTER validation) - used for adjust_pairQuality
         // This matches legacy hb_numlist behavior which uses validated H-bonds
-        if (result.is_valid) {
-            result.hbonds = find_hydrogen_bonds(res1, res2);
+        if (result.is_valid && hbond_detail == HBondDetail::LIST) {
+            result.hbonds = find_hydrogen_bonds(prepared1, prepared2);
+            for (const auto& hbond : result.hbonds) {
+                result.num_good_hb += QualityScoreCalculator::is_good_hbond(hbond.type, hbond.distance);
+            }
+        } else if (result.is_valid) {
+            result.num_good_hb = count_good_hydrogen_bonds(prepared1, prepared2);
         }
 
         // Determine base pair type (simplified - would need calculate_more_bppars)
@@ -246,20 +280,35 @@ std::optional<Vector3D> BasePairValidator::find_n1_n9_position(const Residue& re
 
 double BasePairValidator::calculate_overlap_area(const Residue& res1, const Residue& res2, const Vector3D& oave,
                                                  const Vector3D& zave) const {
-    // Delegate to OverlapCalculator with cached ring data
-    return validation::OverlapCalculator::calculate(res1, res2, oave, zave, ring_data_cache_);
+    return validation::OverlapCalculator::calculate(validation::ResidueRingData::compute(res1),
+                                                    validation::ResidueRingData::compute(res2), oave, zave);
+}
+
+void BasePairValidator::count_hydrogen_bonds_simple(const PreparedResidue& res1, const PreparedResidue& res2,
+                                                    ValidationResult& result) const {
+    hbond_detector_.count_potential_hbonds(res1.residue, res1.hbond_atoms, res2.residue, res2.hbond_atoms,
+                                           result.num_base_hb, result.num_o2_hb);
+
+    // Check H-bond requirement (matches legacy lines 4616-4617)
+    if (params_.min_base_hb > 0) {
+        result.hbond_check = (result.num_base_hb >= params_.min_base_hb);
+    } else {
+        result.hbond_check = (result.num_o2_hb > 0 || result.num_base_hb > 0);
+    }
 }
 
 std::vector<core::hydrogen_bond> BasePairValidator::find_hydrogen_bonds(const Residue& res1,
                                                                         const Residue& res2) const {
-    // Use new HBondDetector with legacy-compatible parameters
-    using namespace x3dna::algorithms::hydrogen_bond;
-
-    HBondDetector detector(HBondDetectionParams::legacy_compatible());
+    const PreparedResidues prepared = prepare({&res1, &res2});
+    return find_hydrogen_bonds(prepared[0], prepared[1]);
+}
 
+std::vector<core::hydrogen_bond> BasePairValidator::find_hydrogen_bonds(const PreparedResidue& res1,
+                                                                        const PreparedResidue& res2) const {
     // Detect ALL H-bonds (not just base-base) to match baseline behavior
-    auto result = detector.detect_all_hbonds_detailed(res1, res2,
-        core::typing::MoleculeType::NUCLEIC_ACID, core::typing::MoleculeType::NUCLEIC_ACID);
+    auto result = hbond_detector_.detect_all_hbonds_detailed(
+        res1.residue, res1.hbond_atoms, res2.residue, res2.hbond_atoms, core::typing::MoleculeType::NUCLEIC_ACID,
+        core::typing::MoleculeType::NUCLEIC_ACID);
 
     // Helper to pad atom name to 4 characters (matches legacy " O2 " format)
     auto pad_atom_name = [](const std::string& name) -> std::string {
@@ -283,6 +332,19 @@ std::vector<core::hydrogen_bond> BasePairValidator::find_hydrogen_bonds(const Re
     return valid_hbonds;
 }
 
+int BasePairValidator::count_good_hydrogen_bonds(const PreparedResidue& res1, const PreparedResidue& res2) const {
+    auto result = hbond_detector_.classify_all_hbonds(res1.residue, res1.hbond_atoms, res2.residue,
+                                                      res2.hbond_atoms, core::typing::MoleculeType::NUCLEIC_ACID,
+                                                      core::typing::MoleculeType::NUCLEIC_ACID);
+
+    // Same bonds and types find_hydrogen_bonds would list
+    int num_good_hb = 0;
+    for (const auto& hbond : result.final_bonds) {
+        num_good_hb += QualityScoreCalculator::is_good_hbond(hbond.legacy_type_char(), hbond.distance);
+    }
+    return num_good_hb;
+}
+
 char BasePairValidator::donor_acceptor(char base1, char base2, const std::string& atom1, const std::string& atom2) {
     // Matches legacy donor_acceptor function
     // CB_LIST = "ACGITU" (A=0, C=1, G=2, I=3, T=4, U=5)
@@ -384,6 +446,30 @@ char BasePairValidator::donor_acceptor(char base1, char base2, const std::string
     return hbatom_type;
 }
 
+char BasePairValidator::donor_acceptor(char base1, char base2, const core::Atom& atom1, const core::Atom& atom2) {
+    namespace tables = hydrogen_bond::atom_type_tables;
+    if (!tables::uses_atom_type_tables(atom1) || !tables::uses_atom_type_tables(atom2)) {
+        return donor_acceptor(base1, base2, atom1.name(), atom2.name());
+    }
+
+    const size_t inum = tables::legacy_base_index(base1);
+    const size_t jnum = tables::legacy_base_index(base2);
+    if (inum == tables::UNKNOWN_BASE || jnum == tables::UNKNOWN_BASE) {
+        return '*'; // Invalid base
+    }
+
+    const char ia = tables::LEGACY_ROLES[inum][static_cast<size_t>(atom1.atom_type())];
+    const char ja = tables::LEGACY_ROLES[jnum][static_cast<size_t>(atom2.atom_type())];
+    if (!ia || !ja) {
+        return '*';
+    }
+
+    // Valid da_types: "AD", "AX", "XD", "XX", "DA", "DX", "XA"
+    const bool standard = (ia == 'A' && (ja == 'D' || ja == 'X')) || (ia == 'X' && ja != '?') ||
+                          (ia == 'D' && (ja == 'A' || ja == 'X'));
+    return standard ? '-' : '*';
+}
+
 bool BasePairValidator::pattern_match(const std::string& str, const std::string& pattern) {
     // Matches legacy str_pmatch: pattern matching where '.' matches any character
     if (str.length() != pattern.length()) {
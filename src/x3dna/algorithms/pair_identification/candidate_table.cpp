@@ -0,0 +1,77 @@
+/**
+ * @file candidate_table.cpp
+ * @brief Implementation of CandidateTable
+ */
+
+#include <x3dna/algorithms/pair_identification/candidate_table.hpp>
+#include <algorithm>
+
+namespace x3dna {
+namespace algorithms {
+
+void CandidateTable::reset(int max_legacy_idx) {
+    max_legacy_idx_ = std::max(max_legacy_idx, 0);
+    pairs_.clear();
+    scores_.clear();
+    entries_.clear();
+    row_start_.assign(static_cast<size_t>(max_legacy_idx_) + 2, 0);
+}
+
+void CandidateTable::add(int idx1, int idx2, CandidateInfo info, double score) {
+    pairs_.emplace_back(PairKey{idx1, idx2}, std::move(info));
+    scores_.push_back(score);
+}
+
+void CandidateTable::finalize() {
+    // Count entries per row (each pair appears in both rows)
+    std::fill(row_start_.begin(), row_start_.end(), 0);
+    for (const auto& [key, info] : pairs_) {
+        ++row_start_[static_cast<size_t>(key.first) + 1];
+        ++row_start_[static_cast<size_t>(key.second) + 1];
+    }
+    for (size_t r = 1; r < row_start_.size(); ++r) {
+        row_start_[r] += row_start_[r - 1];
+    }
+
+    entries_.resize(pairs_.size() * 2);
+    std::vector<size_t> fill(row_start_.begin(), row_start_.end() - 1);
+    for (size_t i = 0; i < pairs_.size(); ++i) {
+        const auto& [key, info] = pairs_[i];
+        const bool valid = info.is_valid();
+        entries_[fill[static_cast<size_t>(key.first)]++] = {key.second, info.bp_type_id, scores_[i], i, valid};
+        entries_[fill[static_cast<size_t>(key.second)]++] = {key.first, info.bp_type_id, scores_[i], i, valid};
+    }
+
+    // Pairs added in ascending (idx1, idx2) order already yield sorted rows; sort anyway
+    // so lookups stay correct for any insertion order
+    auto by_partner = [](const CandidateEntry& a, const CandidateEntry& b) { return a.partner < b.partner; };
+    for (size_t r = 0; r + 1 < row_start_.size(); ++r) {
+        auto first = entries_.begin() + static_cast<std::ptrdiff_t>(row_start_[r]);
+        auto last = entries_.begin() + static_cast<std::ptrdiff_t>(row_start_[r + 1]);
+        if (!std::is_sorted(first, last, by_partner)) {
+            std::sort(first, last, by_partner);
+        }
+    }
+
+    scores_.clear();
+    scores_.shrink_to_fit();
+}
+
+CandidateTable::Row CandidateTable::row(int legacy_idx) const {
+    if (legacy_idx < 0 || legacy_idx > max_legacy_idx_ || entries_.empty()) {
+        return Row(nullptr, nullptr);
+    }
+    const CandidateEntry* base = entries_.data();
+    return Row(base + row_start_[static_cast<size_t>(legacy_idx)],
+               base + row_start_[static_cast<size_t>(legacy_idx) + 1]);
+}
+
+const CandidateEntry* CandidateTable::find_entry(int legacy_idx, int partner) const {
+    const Row r = row(legacy_idx);
+    const CandidateEntry* it = std::lower_bound(r.begin(), r.end(), partner,
+                                                [](const CandidateEntry& e, int value) { return e.partner < value; });
+    return (it != r.end() && it->partner == partner) ? it : nullptr;
+}
+
+} // namespace algorithms
+} // namespace x3dna
@@ -0,0 +1,144 @@
+/**
+ * @file frame_table.cpp
+ * @brief Implementation of FrameTable
+ */
+
+#include <x3dna/algorithms/pair_identification/frame_table.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace x3dna {
+namespace algorithms {
+
+namespace {
+
+// Slack on every frame-only limit: values within it of a bound are left to full validation,
+// so rounding differences against BasePairValidator can never reject a valid pair
+constexpr double SCREEN_TOLERANCE = 1e-6;
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+
+} // namespace
+
+void FrameTable::build(const std::vector<const core::Residue*>& residues) {
+    const size_t n = residues.size();
+    for (auto* column : {&ox_, &oy_, &oz_, &xx_, &xy_, &xz_, &yx_, &yy_, &yz_, &zx_, &zy_, &zz_}) {
+        column->assign(n, 0.0);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        const auto frame = residues[i]->reference_frame();
+        if (!frame.has_value()) {
+            throw std::invalid_argument("FrameTable: residue " + residues[i]->res_id() + " has no reference frame");
+        }
+        const auto& o = frame->origin();
+        const auto x = frame->x_axis();
+        const auto y = frame->y_axis();
+        const auto z = frame->z_axis();
+        ox_[i] = o.x(), oy_[i] = o.y(), oz_[i] = o.z();
+        xx_[i] = x.x(), xy_[i] = x.y(), xz_[i] = x.z();
+        yx_[i] = y.x(), yy_[i] = y.y(), yz_[i] = y.z();
+        zx_[i] = z.x(), zy_[i] = z.y(), zz_[i] = z.z();
+    }
+}
+
+void FrameTable::prefilter(size_t i, const size_t* others, size_t count, const ValidationParameters& params,
+                           PairGeometry* out) const {
+    const double max_dorg_sq = params.max_dorg * params.max_dorg;
+    const double min_dorg = params.min_dorg - SCREEN_TOLERANCE;
+    const double min_dv = params.min_dv - SCREEN_TOLERANCE;
+    const double max_dv = params.max_dv + SCREEN_TOLERANCE;
+
+    // Plane angle in [min, max] (folded to 0-90 degrees) <=> cos(max) <= |z1.z2| <= cos(min)
+    const double lowest_cos = params.max_plane_angle >= 90.0
+                                  ? -std::numeric_limits<double>::infinity()
+                                  : std::cos(std::max(params.max_plane_angle, 0.0) * DEG_TO_RAD) - SCREEN_TOLERANCE;
+    const double highest_cos = params.min_plane_angle <= 0.0
+                                   ? std::numeric_limits<double>::infinity()
+                                   : std::cos(std::min(params.min_plane_angle, 90.0) * DEG_TO_RAD) + SCREEN_TOLERANCE;
+
+    // Residue i, broadcast over the block
+    const double oxi = ox_[i], oyi = oy_[i], ozi = oz_[i];
+    const double xxi = xx_[i], xyi = xy_[i], xzi = xz_[i];
+    const double yxi = yx_[i], yyi = yy_[i], yzi = yz_[i];
+    const double zxi = zx_[i], zyi = zy_[i], zzi = zz_[i];
+
+    std::array<double, BLOCK_SIZE> dx, dy, dz, dist_sq, dir_x, dir_y, dir_z, d_v;
+
+    for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+        const size_t m = std::min(BLOCK_SIZE, count - start);
+        const size_t* block = others + start;
+
+        // Each pass is a branch-free loop without cross-iteration dependencies, so the
+        // compiler can vectorize it for whatever ISA the library is built for
+        for (size_t k = 0; k < m; ++k) {
+            const size_t j = block[k];
+            dx[k] = oxi - ox_[j];
+            dy[k] = oyi - oy_[j];
+            dz[k] = ozi - oz_[j];
+            dir_x[k] = xxi * xx_[j] + xyi * xy_[j] + xzi * xz_[j];
+            dir_y[k] = yxi * yx_[j] + yyi * yy_[j] + yzi * yz_[j];
+            dir_z[k] = zxi * zx_[j] + zyi * zy_[j] + zzi * zz_[j];
+        }
+
+        for (size_t k = 0; k < m; ++k) {
+            dist_sq[k] = dx[k] * dx[k] + dy[k] * dy[k] + dz[k] * dz[k];
+        }
+
+        // d_v = |dorg . zave|, with zave from BasePairValidator::get_bp_zoave
+        for (size_t k = 0; k < m; ++k) {
+            const size_t j = block[k];
+            const double sign = dir_z[k] > 0.0 ? 1.0 : -1.0;
+            double ax = zx_[j] + sign * zxi;
+            double ay = zy_[j] + sign * zyi;
+            double az = zz_[j] + sign * zzi;
+            const double len = std::sqrt(ax * ax + ay * ay + az * az);
+            const bool normalizable = len > 1e-10;
+            ax = normalizable ? ax / len : zxi;
+            ay = normalizable ? ay / len : zyi;
+            az = normalizable ? az / len : zzi;
+            d_v[k] = std::abs(dx[k] * ax + dy[k] * ay + dz[k] * az);
+        }
+
+        for (size_t k = 0; k < m; ++k) {
+            PairGeometry& g = out[start + k];
+            g.dorg = std::sqrt(dist_sq[k]);
+            g.d_v = d_v[k];
+            g.dir_x = dir_x[k];
+            g.dir_y = dir_y[k];
+            g.dir_z = dir_z[k];
+
+            const double cos_angle = std::abs(dir_z[k]);
+            const bool fails = g.dorg < min_dorg || d_v[k] < min_dv || d_v[k] > max_dv || cos_angle < lowest_cos ||
+                               cos_angle > highest_cos;
+            g.screen = dist_sq[k] > max_dorg_sq ? Screen::OUT_OF_RANGE : (fails ? Screen::REJECTED : Screen::CANDIDATE);
+        }
+    }
+}
+
+ValidationResult FrameTable::rejected_result(const PairGeometry& geometry, const ValidationParameters& params) {
+    ValidationResult result;
+    result.dorg = geometry.dorg;
+    result.d_v = geometry.d_v;
+    result.dir_x = geometry.dir_x;
+    result.dir_y = geometry.dir_y;
+    result.dir_z = geometry.dir_z;
+
+    // Same folding as BasePairValidator::z1_z2_angle_in_0_to_90
+    const double angle_deg = std::acos(std::max(-1.0, std::min(1.0, geometry.dir_z))) * 180.0 / M_PI;
+    result.plane_angle = angle_deg > 90.0 ? 180.0 - angle_deg : angle_deg;
+    result.quality_score = result.dorg + validation_constants::D_V_WEIGHT * result.d_v +
+                           result.plane_angle / validation_constants::PLANE_ANGLE_DIVISOR;
+
+    auto in_range = [](double value, double lo, double hi) { return value >= lo && value <= hi; };
+    result.distance_check = in_range(result.dorg, params.min_dorg, params.max_dorg);
+    result.d_v_check = in_range(result.d_v, params.min_dv, params.max_dv);
+    result.plane_angle_check = in_range(result.plane_angle, params.min_plane_angle, params.max_plane_angle);
+    return result;
+}
+
+} // namespace algorithms
+} // namespace x3dna
@@ -0,0 +1,115 @@
+/**
+ * @file mutual_best_matcher.cpp
+ * @brief Implementation of MutualBestMatcher
+ */
+
+#include <x3dna/algorithms/pair_identification/mutual_best_matcher.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace x3dna {
+namespace algorithms {
+
+MutualBestMatcher::MutualBestMatcher(const CandidateTable& table)
+    : table_(table), max_legacy_idx_(table.max_legacy_idx()) {
+    const size_t n = static_cast<size_t>(max_legacy_idx_) + 1;
+    queue_start_.assign(n + 1, 0);
+    cursor_.assign(n, 0);
+    matched_.assign(n, false);
+    watchers_.assign(n, {});
+
+    // Only valid candidates with a finite-comparable score can ever win a strict '<' scan
+    for (int idx = 1; idx <= max_legacy_idx_; ++idx) {
+        queue_start_[static_cast<size_t>(idx)] = ranked_.size();
+        for (const auto& entry : table_.row(idx)) {
+            if (entry.is_valid && entry.score < std::numeric_limits<double>::max()) {
+                ranked_.push_back({entry.score, entry.partner});
+            }
+        }
+        // Rows are sorted by partner, so a stable sort on score keeps the legacy tie-break
+        // (lowest partner index wins among equal scores)
+        std::stable_sort(ranked_.begin() + static_cast<std::ptrdiff_t>(queue_start_[static_cast<size_t>(idx)]),
+                         ranked_.end(),
+                         [](const RankedPartner& a, const RankedPartner& b) { return a.score < b.score; });
+        cursor_[static_cast<size_t>(idx)] = queue_start_[static_cast<size_t>(idx)];
+    }
+    queue_start_[n] = ranked_.size();
+}
+
+int MutualBestMatcher::best_partner(int idx) {
+    size_t& pos = cursor_[static_cast<size_t>(idx)];
+    const size_t end = queue_start_[static_cast<size_t>(idx) + 1];
+    while (pos < end && matched_[static_cast<size_t>(ranked_[pos].partner)]) {
+        ++pos;
+    }
+    return (pos < end) ? ranked_[pos].partner : 0;
+}
+
+void MutualBestMatcher::schedule_if_mutual(int idx, int pass, int position) {
+    const int partner = best_partner(idx);
+    if (partner == 0 || best_partner(partner) != idx) {
+        return;
+    }
+
+    // The legacy scan selects the pair at the next visit of either member
+    const int lo = std::min(idx, partner);
+    const int hi = std::max(idx, partner);
+    if (lo > position) {
+        events_.emplace(pass, lo, hi);
+    } else if (hi > position) {
+        events_.emplace(pass, hi, lo);
+    } else {
+        events_.emplace(pass + 1, lo, hi);
+    }
+}
+
+std::vector<MutualBestMatcher::Match> MutualBestMatcher::run() {
+    std::vector<Match> matches;
+
+    for (int idx = 1; idx <= max_legacy_idx_; ++idx) {
+        const int partner = best_partner(idx);
+        if (partner != 0) {
+            watchers_[static_cast<size_t>(partner)].push_back(idx);
+        }
+    }
+    for (int idx = 1; idx <= max_legacy_idx_; ++idx) {
+        schedule_if_mutual(idx, 1, 0);
+    }
+
+    int last_pass_with_match = 0;
+    while (!events_.empty()) {
+        const auto [pass, idx1, idx2] = *events_.begin();
+        events_.erase(events_.begin());
+        if (matched_[static_cast<size_t>(idx1)] || matched_[static_cast<size_t>(idx2)]) {
+            continue;
+        }
+
+        matched_[static_cast<size_t>(idx1)] = true;
+        matched_[static_cast<size_t>(idx2)] = true;
+        matches.push_back({idx1, idx2});
+        last_pass_with_match = pass;
+
+        // Only residues whose best partner was just consumed can change
+        for (int consumed : {idx1, idx2}) {
+            std::vector<int> watchers;
+            watchers.swap(watchers_[static_cast<size_t>(consumed)]);
+            for (int idx : watchers) {
+                if (matched_[static_cast<size_t>(idx)]) {
+                    continue;
+                }
+                const int partner = best_partner(idx);
+                if (partner != 0) {
+                    watchers_[static_cast<size_t>(partner)].push_back(idx);
+                }
+                schedule_if_mutual(idx, pass, idx1);
+            }
+        }
+    }
+
+    // Legacy stops after the first pass that selects nothing
+    num_passes_ = last_pass_with_match + 1;
+    return matches;
+}
+
+} // namespace algorithms
+} // namespace x3dna
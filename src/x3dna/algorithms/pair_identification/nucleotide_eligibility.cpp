@@ -0,0 +1,216 @@
+/**
+ * @file nucleotide_eligibility.cpp
+ * @brief Implementation of NucleotideEligibility
+ */
+
+#include <x3dna/algorithms/pair_identification/nucleotide_eligibility.hpp>
+#include <x3dna/algorithms/validation_constants.hpp>
+#include <x3dna/core/thread_pool.hpp>
+#include <x3dna/core/typing/atom_type.hpp>
+#include <x3dna/geometry/qcp_rmsd.hpp>
+#include <x3dna/geometry/vector3d.hpp>
+#include <algorithm>
+#include <array>
+
+namespace x3dna {
+namespace algorithms {
+
+using namespace x3dna::core;
+using core::AtomType;
+using core::RING_ATOM_TYPES;
+using core::NUM_RING_ATOM_TYPES;
+
+namespace {
+// Standard nucleotide ring geometry (from legacy xyz_ring array)
+// Matches RA_LIST order: " C4 ", " N3 ", " C2 ", " N1 ", " C6 ", " C5 ", " N7 ", " C8 ", " N9 "
+constexpr std::array<std::array<double, 3>, 9> STANDARD_RING_GEOMETRY = {{
+    {{-1.265, 3.177, 0.000}}, // C4
+    {{-2.342, 2.364, 0.001}}, // N3
+    {{-1.999, 1.087, 0.000}}, // C2
+    {{-0.700, 0.641, 0.000}}, // N1
+    {{0.424, 1.460, 0.000}},  // C6
+    {{0.071, 2.833, 0.000}},  // C5
+    {{0.870, 3.969, 0.000}},  // N7 (purine)
+    {{0.023, 4.962, 0.000}},  // C8 (purine)
+    {{-1.289, 4.551, 0.000}}, // N9 (purine)
+}};
+
+// Legacy RA_LIST order for ring atoms (using trimmed names)
+// Ring atom names array removed - now using RING_ATOM_TYPES from atom_type.hpp
+
+// Use constant from validation_constants.hpp
+using validation_constants::NT_RMSD_CUTOFF;
+
+/**
+ * @brief Check nucleotide type by RMSD (matches legacy check_nt_type_by_rmsd)
+ * @param residue Residue to check
+ * @return RMSD value if calculable, or RMSD_DUMMY if not enough atoms
+ */
+std::optional<double> check_nt_type_by_rmsd(const Residue& residue) {
+    // Find ring atoms in residue using AtomType for O(1) comparison (standard, experimental)
+    geometry::LeastSquaresFitter::PointBlock ring;
+    int nN = 0; // Count of nitrogen atoms (N1, N3, N7, N9)
+    bool has_c1_prime = false;
+
+    // LEGACY BEHAVIOR: Try ALL 9 ring atoms first (matches legacy residue_ident)
+    for (size_t i = 0; i < NUM_RING_ATOM_TYPES; ++i) {
+        AtomType target_type = RING_ATOM_TYPES[i];
+        const Atom* atom = residue.find_atom_by_type(target_type);
+        if (atom != nullptr) {
+            // Pair with the corresponding standard geometry
+            ring.add(geometry::Vector3D(STANDARD_RING_GEOMETRY[i][0], STANDARD_RING_GEOMETRY[i][1],
+                                        STANDARD_RING_GEOMETRY[i][2]),
+                     atom->position());
+
+            // Count nitrogen atoms (indices 1=N3, 3=N1, 6=N7, 8=N9)
+            if (i == 1 || i == 3 || i == 6 || i == 8) {
+                nN++;
+            }
+        }
+    }
+
+    // Check for C1' using AtomType, or C1R via string (alternative name)
+    if (residue.has_atom_type(AtomType::C1_PRIME)) {
+        has_c1_prime = true;
+    } else {
+        for (const auto& atom : residue.atoms()) {
+            if (atom.name() == "C1R") {
+                has_c1_prime = true;
+                break;
+            }
+        }
+    }
+
+    // Legacy requires: (!nN && !C1_prime) -> return DUMMY
+    if (nN == 0 && !has_c1_prime) {
+        return std::nullopt; // DUMMY
+    }
+
+    // RMSD of the least-squares fit (matches legacy ls_fitting); std::nullopt (DUMMY)
+    // when fewer than 3 atoms are available
+    return geometry::superposition_rmsd(ring);
+}
+
+// Additional helpers for is_nucleotide using AtomType
+
+// Common ring atom types (pyrimidine ring)
+constexpr std::array<AtomType, 6> COMMON_RING_ATOM_TYPES = {
+    AtomType::C4, AtomType::N3, AtomType::C2, AtomType::N1, AtomType::C6, AtomType::C5
+};
+// Purine-only ring atom types
+constexpr std::array<AtomType, 3> PURINE_RING_ATOM_TYPES = {AtomType::N7, AtomType::C8, AtomType::N9};
+
+bool is_standard_nucleotide(core::typing::BaseType type) {
+    return type == core::typing::BaseType::ADENINE || type == core::typing::BaseType::CYTOSINE ||
+           type == core::typing::BaseType::GUANINE || type == core::typing::BaseType::THYMINE ||
+           type == core::typing::BaseType::URACIL;
+}
+
+bool is_recognized_modified_nucleotide(core::typing::BaseType type) {
+    return type == core::typing::BaseType::PSEUDOURIDINE || type == core::typing::BaseType::INOSINE;
+}
+
+bool needs_rmsd_validation(const Residue& residue) {
+    auto mol_type = residue.molecule_type();
+    auto base_type = residue.base_type();
+    return mol_type == core::typing::MoleculeType::UNKNOWN ||
+           (mol_type == core::typing::MoleculeType::NUCLEIC_ACID && base_type == core::typing::BaseType::UNKNOWN);
+}
+
+// Count matching atoms using AtomType array
+template <size_t N> int count_matching_atom_types(const Residue& residue, const std::array<AtomType, N>& atom_types) {
+    int count = 0;
+    for (auto type : atom_types) {
+        if (residue.has_atom_type(type))
+            count++;
+    }
+    return count;
+}
+
+bool passes_rmsd_nucleotide_check(const Residue& residue, std::optional<double>* rmsd_out) {
+    const int common_count = count_matching_atom_types(residue, COMMON_RING_ATOM_TYPES);
+    const int purine_count = count_matching_atom_types(residue, PURINE_RING_ATOM_TYPES);
+    const int total_ring_atoms = common_count + purine_count;
+
+    if (total_ring_atoms < 3)
+        return false;
+
+    auto rmsd = check_nt_type_by_rmsd(residue);
+    if (rmsd_out) {
+        *rmsd_out = rmsd;
+    }
+    return rmsd.has_value() && *rmsd <= NT_RMSD_CUTOFF;
+}
+
+} // namespace
+
+bool NucleotideEligibility::classify(const Residue& residue, std::optional<double>* rmsd_out) {
+    const auto base_type = residue.base_type();
+
+    // Standard nucleotides (A, C, G, T, U)
+    if (is_standard_nucleotide(base_type))
+        return true;
+
+    // Explicitly recognized modified nucleotides
+    if (is_recognized_modified_nucleotide(base_type))
+        return true;
+
+    // Unknown or noncanonical residues need RMSD validation
+    if (needs_rmsd_validation(residue)) {
+        return passes_rmsd_nucleotide_check(residue, rmsd_out);
+    }
+
+    return false;
+}
+
+bool NucleotideEligibility::has_base_ring(const Residue& residue) {
+    // Frame-recording criterion: typed nucleotides, or unknown residues carrying a partial base ring
+    if (residue.is_nucleotide()) {
+        return true;
+    }
+    return residue.molecule_type() == core::typing::MoleculeType::UNKNOWN &&
+           count_matching_atom_types(residue, COMMON_RING_ATOM_TYPES) >= 3;
+}
+
+void NucleotideEligibility::build(const Structure& structure, int num_threads) {
+    clear();
+
+    std::vector<const Residue*> residues;
+    for (const auto& chain : structure.chains()) {
+        for (const auto& residue : chain.residues()) {
+            const int legacy_idx = residue.legacy_residue_idx();
+            if (legacy_idx <= 0) {
+                continue;
+            }
+            if (legacy_idx >= static_cast<int>(residues.size())) {
+                residues.resize(static_cast<size_t>(legacy_idx) + 1, nullptr);
+            }
+            residues[static_cast<size_t>(legacy_idx)] = &residue;
+        }
+    }
+    entries_.resize(residues.size());
+
+    auto classify_entry = [&](size_t idx, size_t /* worker */) {
+        if (const Residue* residue = residues[idx]) {
+            Entry& entry = entries_[idx];
+            entry.is_nucleotide = classify(*residue, &entry.rmsd);
+        }
+    };
+
+    const size_t threads = ThreadPool::resolve_thread_count(num_threads);
+    if (threads <= 1) {
+        for (size_t idx = 0; idx < residues.size(); ++idx) {
+            classify_entry(idx, 0);
+        }
+        return;
+    }
+    ThreadPool pool(std::min(threads, residues.size()));
+    pool.parallel_for(residues.size(), classify_entry);
+}
+
+void NucleotideEligibility::clear() {
+    entries_.clear();
+}
+
+} // namespace algorithms
+} // namespace x3dna
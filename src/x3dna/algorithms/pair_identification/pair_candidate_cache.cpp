@@ -4,12 +4,16 @@
  */
 
 #include <x3dna/algorithms/pair_identification/pair_candidate_cache.hpp>
+#include <x3dna/core/thread_pool.hpp>
+#include <limits>
+#include <tuple>
 
 namespace x3dna {
 namespace algorithms {
 
 void PairCandidateCache::build(const core::Structure& structure, const BasePairValidator& validator,
-                               const QualityScoreCalculator& quality_calc, NucleotideChecker is_nucleotide) {
+                               const QualityScoreCalculator& quality_calc, NucleotideChecker is_nucleotide,
+                               int num_threads) {
     clear();
 
     // Build index map from structure
@@ -19,67 +23,111 @@ void PairCandidateCache::build(const core::Structure& structure, const BasePairV
         return;
     }
 
-    int max_idx = index_map_.max_legacy_idx();
-
-    // PHASE 1: Validate ALL pairs (matches legacy check_pair loop)
-    // Legacy: for (i = 1; i < num_residue; i++) { for (j = i + 1; j <= num_residue; j++) { ... } }
-    // Note: Legacy uses i < num_residue, so i goes from 1 to num_residue-1 (inclusive)
-    for (int legacy_idx1 = 1; legacy_idx1 <= max_idx - 1; ++legacy_idx1) {
-        const core::Residue* res1 = index_map_.get_by_legacy_idx(legacy_idx1);
-        if (!res1) {
-            continue;
+    // Nucleotides with a valid frame, in ascending legacy order
+    std::vector<int> eligible;
+    for (int legacy_idx = 1; legacy_idx <= index_map_.max_legacy_idx(); ++legacy_idx) {
+        const core::Residue* res = index_map_.get_by_legacy_idx(legacy_idx);
+        if (res && is_nucleotide(*res) && res->reference_frame().has_value()) {
+            eligible.push_back(legacy_idx);
         }
+    }
+    validate_pairs(eligible, validator, quality_calc, num_threads);
+}
+
+void PairCandidateCache::build(const core::Structure& structure, const BasePairValidator& validator,
+                               const QualityScoreCalculator& quality_calc, const NucleotideEligibility& eligibility,
+                               int num_threads) {
+    clear();
 
-        // Check if res1 is a nucleotide with a valid frame
-        if (!is_nucleotide(*res1) || !res1->reference_frame().has_value()) {
-            continue;
+    index_map_.build(structure);
+
+    if (index_map_.empty()) {
+        return;
+    }
+
+    std::vector<int> eligible;
+    for (int legacy_idx = 1; legacy_idx <= index_map_.max_legacy_idx(); ++legacy_idx) {
+        const core::Residue* res = index_map_.get_by_legacy_idx(legacy_idx);
+        if (res && eligibility.is_nucleotide(legacy_idx) && res->reference_frame().has_value()) {
+            eligible.push_back(legacy_idx);
         }
+    }
+    validate_pairs(eligible, validator, quality_calc, num_threads);
+}
+
+void PairCandidateCache::validate_pairs(const std::vector<int>& eligible, const BasePairValidator& validator,
+                                        const QualityScoreCalculator& quality_calc, int num_threads) {
+    table_.reset(index_map_.max_legacy_idx());
+    const size_t n = eligible.size();
 
-        for (int legacy_idx2 = legacy_idx1 + 1; legacy_idx2 <= max_idx; ++legacy_idx2) {
-            const core::Residue* res2 = index_map_.get_by_legacy_idx(legacy_idx2);
-            if (!res2) {
-                continue;
-            }
+    // Ring and H-bond atom data computed once per residue, shared read-only by all rows
+    std::vector<const core::Residue*> residues(n);
+    for (size_t i = 0; i < n; ++i) {
+        residues[i] = index_map_.get_by_legacy_idx(eligible[i]);
+    }
+    const PreparedResidues prepared = validator.prepare(std::move(residues));
 
-            // Check if res2 is a nucleotide with a valid frame
-            if (!is_nucleotide(*res2) || !res2->reference_frame().has_value()) {
-                continue;
-            }
+    // PHASE 1: Validate ALL pairs (matches legacy check_pair loop)
+    // Legacy: for (i = 1; i < num_residue; i++) { for (j = i + 1; j <= num_residue; j++) { ... } }
+    auto validate_row = [&](size_t i, auto&& emit) {
+        const core::Residue* res1 = prepared.residues[i];
+        for (size_t j = i + 1; j < n; ++j) {
+            const core::Residue* res2 = prepared.residues[j];
 
             // Validate pair
-            ValidationResult result = validator.validate(*res1, *res2);
+            ValidationResult result = validator.validate(prepared[i], prepared[j]);
 
             // Calculate adjusted quality score and bp_type_id
             double adjusted_score = quality_calc.calculate_selection_score(result, *res1, *res2);
             int bp_type_id = quality_calc.calculate_bp_type_id(*res1, *res2, result);
 
             // Store in cache (already normalized since legacy_idx1 < legacy_idx2)
-            auto key = std::make_pair(legacy_idx1, legacy_idx2);
-            CandidateInfo info{result, bp_type_id, adjusted_score};
-            cache_[key] = info;
-
-            // Track partners
-            all_partners_[legacy_idx1].push_back(legacy_idx2);
-            all_partners_[legacy_idx2].push_back(legacy_idx1);
-
-            if (result.is_valid) {
-                valid_partners_[legacy_idx1].push_back(legacy_idx2);
-                valid_partners_[legacy_idx2].push_back(legacy_idx1);
-            }
+            const double entry_score = result.is_valid ? adjusted_score : std::numeric_limits<double>::max();
+            emit(eligible[i], eligible[j], CandidateInfo{std::move(result), bp_type_id, adjusted_score},
+                 entry_score);
+        }
+    };
+
+    const size_t threads = core::ThreadPool::resolve_thread_count(num_threads);
+    if (threads <= 1 || n < 2) {
+        auto add = [this](int idx1, int idx2, CandidateInfo&& info, double score) {
+            table_.add(idx1, idx2, std::move(info), score);
+        };
+        for (size_t i = 0; i + 1 < n; ++i) {
+            validate_row(i, add);
         }
+        table_.finalize();
+        return;
     }
+
+    // One task per row; rows are merged in order so the table matches a serial build.
+    using Pending = std::tuple<int, int, CandidateInfo, double>;
+    std::vector<std::vector<Pending>> rows(n);
+    core::ThreadPool pool(std::min(threads, n));
+
+    pool.parallel_for(n, [&](size_t i, size_t /* worker */) {
+        auto& out = rows[i];
+        validate_row(i, [&out](int idx1, int idx2, CandidateInfo&& info, double score) {
+            out.emplace_back(idx1, idx2, std::move(info), score);
+        });
+    });
+
+    for (auto& row : rows) {
+        for (auto& [idx1, idx2, info, score] : row) {
+            table_.add(idx1, idx2, std::move(info), score);
+        }
+    }
+    table_.finalize();
 }
 
 void PairCandidateCache::clear() {
-    cache_.clear();
-    valid_partners_.clear();
-    all_partners_.clear();
+    table_.reset(0);
     index_map_.clear();
 }
 
 size_t PairCandidateCache::valid_count() const {
     size_t count = 0;
-    for (const auto& [key, info] : cache_) {
+    for (const auto& [key, info] : table_.pairs()) {
         if (info.is_valid()) {
             count++;
         }
@@ -88,46 +136,39 @@ size_t PairCandidateCache::valid_count() const {
 }
 
 std::optional<CandidateInfo> PairCandidateCache::get(int legacy_idx1, int legacy_idx2) const {
-    auto key = normalize(legacy_idx1, legacy_idx2);
-    auto it = cache_.find(key);
-    if (it != cache_.end()) {
-        return it->second;
+    const CandidateInfo* info = table_.find(legacy_idx1, legacy_idx2);
+    if (info) {
+        return *info;
     }
     return std::nullopt;
 }
 
 bool PairCandidateCache::contains(int legacy_idx1, int legacy_idx2) const {
-    auto key = normalize(legacy_idx1, legacy_idx2);
-    return cache_.find(key) != cache_.end();
+    return table_.find_entry(legacy_idx1, legacy_idx2) != nullptr;
 }
 
 std::vector<int> PairCandidateCache::valid_partners_for(int legacy_idx) const {
-    auto it = valid_partners_.find(legacy_idx);
-    if (it != valid_partners_.end()) {
-        return it->second;
+    std::vector<int> partners;
+    for (const auto& entry : table_.row(legacy_idx)) {
+        if (entry.is_valid) {
+            partners.push_back(entry.partner);
+        }
     }
-    return {};
+    return partners;
 }
 
 std::vector<std::pair<int, CandidateInfo>> PairCandidateCache::all_candidates_for(int legacy_idx) const {
     std::vector<std::pair<int, CandidateInfo>> result;
-
-    auto it = all_partners_.find(legacy_idx);
-    if (it == all_partners_.end()) {
-        return result;
-    }
-
-    for (int partner_idx : it->second) {
-        auto info = get(legacy_idx, partner_idx);
-        if (info) {
-            result.push_back({partner_idx, *info});
-        }
+    const auto row = table_.row(legacy_idx);
+    result.reserve(row.size());
+    for (const auto& entry : row) {
+        result.emplace_back(entry.partner, table_.info(entry));
     }
     return result;
 }
 
 void PairCandidateCache::for_each_valid(std::function<void(int, int, const CandidateInfo&)> callback) const {
-    for (const auto& [key, info] : cache_) {
+    for (const auto& [key, info] : table_.pairs()) {
         if (info.is_valid()) {
             callback(key.first, key.second, info);
         }
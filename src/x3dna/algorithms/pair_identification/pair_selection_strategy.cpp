@@ -4,6 +4,7 @@
  */
 
 #include <x3dna/algorithms/pair_identification/pair_selection_strategy.hpp>
+#include <algorithm>
 #include <limits>
 
 namespace x3dna {
@@ -40,8 +41,8 @@ std::vector<std::pair<int, int>> MutualBestStrategy::select(SelectionContext& co
             }
 
             // Skip if residue doesn't have valid candidates
-            auto partners = context.cache.valid_partners_for(legacy_idx1);
-            if (partners.empty()) {
+            const auto row = context.cache.candidates_for(legacy_idx1);
+            if (std::none_of(row.begin(), row.end(), [](const CandidateEntry& e) { return e.is_valid; })) {
                 continue;
             }
 
@@ -67,7 +68,7 @@ std::vector<std::pair<int, int>> MutualBestStrategy::select(SelectionContext& co
 
             if (is_mutual) {
                 // Verify the pair is valid in the cache
-                auto info = context.cache.get(legacy_idx1, legacy_idx2);
+                const CandidateInfo* info = context.cache.find(legacy_idx1, legacy_idx2);
                 if (!info || !info->is_valid()) {
                     continue;
                 }
@@ -120,18 +121,15 @@ std::optional<std::pair<int, double>> MutualBestStrategy::find_best_partner(int
     // Collect candidates for observer
     std::vector<BestPartnerCandidate> candidates;
 
-    // Get all valid partners from cache
-    auto partners = context.cache.valid_partners_for(legacy_idx);
-
-    for (int partner_idx : partners) {
-        // Skip if partner is already matched
-        if (partner_idx >= static_cast<int>(context.matched_indices.size()) || context.matched_indices[partner_idx]) {
+    // Walk this residue's cached candidates (sorted by partner index)
+    for (const auto& entry : context.cache.candidates_for(legacy_idx)) {
+        if (!entry.is_valid) {
             continue;
         }
 
-        // Get cached info
-        auto info = context.cache.get(legacy_idx, partner_idx);
-        if (!info || !info->is_valid()) {
+        // Skip if partner is already matched
+        const int partner_idx = entry.partner;
+        if (partner_idx >= static_cast<int>(context.matched_indices.size()) || context.matched_indices[partner_idx]) {
             continue;
         }
 
@@ -139,15 +137,15 @@ std::optional<std::pair<int, double>> MutualBestStrategy::find_best_partner(int
         if (observer) {
             BestPartnerCandidate c;
             c.partner_legacy_idx = partner_idx;
-            c.quality_score = info->adjusted_quality_score;
-            c.bp_type_id = info->bp_type_id;
-            c.is_valid = info->is_valid();
+            c.quality_score = entry.score;
+            c.bp_type_id = entry.bp_type_id;
+            c.is_valid = true;
             candidates.push_back(c);
         }
 
         // Update best if this score is better (lower is better)
-        if (info->adjusted_quality_score < best_score) {
-            best_score = info->adjusted_quality_score;
+        if (entry.score < best_score) {
+            best_score = entry.score;
             best_result = std::make_pair(partner_idx, best_score);
         }
     }
@@ -23,7 +23,7 @@ double QualityScoreCalculator::calculate_selection_score(const ValidationResult&
     double adjusted_score = result.quality_score;
 
     // Apply H-bond quality adjustment
-    adjusted_score += adjust_pair_quality(result.hbonds);
+    adjusted_score += adjust_pair_quality(result.num_good_hb);
 
     // Apply bp_type_id == 2 bonus
     int bp_type_id = calculate_bp_type_id(res1, res2, result);
@@ -48,23 +48,14 @@ double QualityScoreCalculator::adjust_pair_quality(const std::vector<core::hydro
     // Legacy ONLY skips '*' types, all others (including ' ') are counted
     int num_good_hb = 0;
     for (const auto& hbond : hbonds) {
-        // Legacy flow: hb_info string excludes type ' ' h-bonds (see get_hbond_ij)
-        // Then adjust_pairQuality skips type '*' via num_list[k][0]
-        // Net result: only type '-' h-bonds are counted for quality adjustment
-        if (hbond.type != '-') {
-            continue;
-        }
-        // Check if distance is in good range [2.5, 3.5]
-        // CRITICAL: Legacy uses %4.2f format in hb_info string, which rounds to 2 decimals
-        // Then hb_numlist parses this string, so 2.4995 becomes 2.50
-        // To match legacy, round distance to 2 decimal places before range check
-        double rounded_dist = std::round(hbond.distance * 100.0) / 100.0;
-        if (rounded_dist >= quality_constants::GOOD_HBOND_MIN_DIST &&
-            rounded_dist <= quality_constants::GOOD_HBOND_MAX_DIST) {
+        if (is_good_hbond(hbond.type, hbond.distance)) {
             num_good_hb++;
         }
     }
+    return adjust_pair_quality(num_good_hb);
+}
 
+double QualityScoreCalculator::adjust_pair_quality(int num_good_hb) const {
     // Legacy: if (num_good_hb >= 2) return -3.0; else return -num_good_hb;
     if (num_good_hb >= quality_constants::MIN_GOOD_HBONDS_FOR_BONUS) {
         return quality_constants::GOOD_HBOND_ADJUSTMENT;
@@ -73,6 +64,22 @@ double QualityScoreCalculator::adjust_pair_quality(const std::vector<core::hydro
     }
 }
 
+bool QualityScoreCalculator::is_good_hbond(char type, double distance) {
+    // Legacy flow: hb_info string excludes type ' ' h-bonds (see get_hbond_ij)
+    // Then adjust_pairQuality skips type '*' via num_list[k][0]
+    // Net result: only type '-' h-bonds are counted for quality adjustment
+    if (type != '-') {
+        return false;
+    }
+    // Check if distance is in good range [2.5, 3.5]
+    // CRITICAL: Legacy uses %4.2f format in hb_info string, which rounds to 2 decimals
+    // Then hb_numlist parses this string, so 2.4995 becomes 2.50
+    // To match legacy, round distance to 2 decimal places before range check
+    double rounded_dist = std::round(distance * 100.0) / 100.0;
+    return rounded_dist >= quality_constants::GOOD_HBOND_MIN_DIST &&
+           rounded_dist <= quality_constants::GOOD_HBOND_MAX_DIST;
+}
+
 int QualityScoreCalculator::calculate_bp_type_id(const core::Residue& res1, const core::Residue& res2,
                                                  const ValidationResult& result) const {
     // Match legacy check_wc_wobble_pair logic
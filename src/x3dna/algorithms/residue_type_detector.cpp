@@ -7,7 +7,7 @@
 #include <x3dna/core/constants.hpp>
 #include <x3dna/core/typing.hpp>
 #include <x3dna/core/typing/atom_type.hpp>
-#include <x3dna/geometry/least_squares_fitter.hpp>
+#include <x3dna/geometry/qcp_rmsd.hpp>
 #include <algorithm>
 #include <cctype>
 
@@ -89,14 +89,12 @@ RmsdCheckResult ResidueTypeDetector::check_by_rmsd(const core::Residue& residue)
         }
     }
 
-    // Perform least-squares fitting (matches legacy ls_fitting)
-    geometry::LeastSquaresFitter fitter;
-    try {
-        auto fit_result = fitter.fit(standard_coords, experimental_coords);
-        return {fit_result.rms, purine_atom_count > 0, matched_names, experimental_coords, standard_coords};
-    } catch (const std::exception&) {
+    // RMSD of the least-squares fit (matches legacy ls_fitting), without building the rotation
+    const auto rms = geometry::superposition_rmsd(standard_coords, experimental_coords);
+    if (!rms.has_value()) {
         return {std::nullopt, purine_atom_count > 0, {}, {}, {}};
     }
+    return {rms, purine_atom_count > 0, matched_names, experimental_coords, standard_coords};
 }
 
 bool ResidueTypeDetector::is_in_nt_list(const std::string& res_name) {
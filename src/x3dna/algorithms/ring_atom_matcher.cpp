@@ -6,10 +6,23 @@
 #include <x3dna/algorithms/ring_atom_matcher.hpp>
 #include <x3dna/core/constants.hpp>
 #include <algorithm>
+#include <array>
 
 namespace x3dna {
 namespace algorithms {
 
+namespace {
+
+// Ring atoms in constants::nucleotides::ring_atoms_for_type order; pyrimidines use the first six
+constexpr std::array<core::typing::AtomType, core::typing::NUM_RING_ATOM_TYPES> RING_MATCH_ORDER = {
+    core::typing::AtomType::N1, core::typing::AtomType::C2, core::typing::AtomType::N3,
+    core::typing::AtomType::C4, core::typing::AtomType::C5, core::typing::AtomType::C6,
+    core::typing::AtomType::N7, core::typing::AtomType::C8, core::typing::AtomType::N9};
+
+constexpr size_t NUM_PYRIMIDINE_RING_ATOMS = 6;
+
+} // namespace
+
 MatchedAtoms RingAtomMatcher::match(const core::Residue& residue, const core::Structure& standard_template,
                                     std::optional<core::typing::BaseType> detected_type) {
     MatchedAtoms result;
@@ -37,6 +50,37 @@ MatchedAtoms RingAtomMatcher::match(const core::Residue& residue, const core::St
     return result;
 }
 
+size_t RingAtomMatcher::match(const core::Residue& residue, const RingTemplate& ring_template,
+                              core::typing::BaseType base_type, std::vector<std::string>& atom_names,
+                              std::vector<geometry::Vector3D>& standard_coords,
+                              std::vector<geometry::Vector3D>& experimental_coords) {
+    // First residue atom of each ring type, as a name search would find it
+    std::array<const core::Atom*, RingTemplate::NUM_SLOTS> residue_atoms{};
+    for (const auto& atom : residue.atoms()) {
+        const auto type = atom.atom_type();
+        const auto slot = static_cast<size_t>(type);
+        if (core::typing::is_ring_atom(type) && residue_atoms[slot] == nullptr) {
+            residue_atoms[slot] = &atom;
+        }
+    }
+
+    const auto& names = constants::nucleotides::ring_atoms_for_type(base_type);
+    const size_t num_ring_atoms = is_purine(base_type) ? RING_MATCH_ORDER.size() : NUM_PYRIMIDINE_RING_ATOMS;
+    size_t num_matched = 0;
+    for (size_t i = 0; i < num_ring_atoms; ++i) {
+        const auto type = RING_MATCH_ORDER[i];
+        const core::Atom* exp_atom = residue_atoms[static_cast<size_t>(type)];
+        if (exp_atom == nullptr || !ring_template.has(type)) {
+            continue;
+        }
+        atom_names.push_back(names[i]);
+        standard_coords.push_back(ring_template.position(type));
+        experimental_coords.push_back(exp_atom->position());
+        ++num_matched;
+    }
+    return num_matched;
+}
+
 std::vector<std::string> RingAtomMatcher::get_ring_atom_names(core::typing::BaseType base_type) {
     // Use constants as single source of truth for ring atom names
     // Return trimmed names directly - no padding needed since atoms are stored trimmed
@@ -24,6 +24,25 @@ StandardBaseTemplates::StandardBaseTemplates(const std::filesystem::path& templa
     }
 }
 
+StandardBaseTemplates::StandardBaseTemplates(const StandardBaseTemplates& other) {
+    std::lock_guard<std::mutex> lock(other.cache_mutex_);
+    template_path_ = other.template_path_;
+    cache_ = other.cache_;
+    ring_cache_ = other.ring_cache_;
+    parser_ = other.parser_;
+}
+
+StandardBaseTemplates& StandardBaseTemplates::operator=(const StandardBaseTemplates& other) {
+    if (this != &other) {
+        std::scoped_lock lock(cache_mutex_, other.cache_mutex_);
+        template_path_ = other.template_path_;
+        cache_ = other.cache_;
+        ring_cache_ = other.ring_cache_;
+        parser_ = other.parser_;
+    }
+    return *this;
+}
+
 std::string StandardBaseTemplates::type_to_filename(core::typing::BaseType type, bool is_modified) {
     // Legacy: uppercase one_letter_code -> Atomic_X.pdb, lowercase -> Atomic.x.pdb
     // is_modified=true uses lowercase template (for modified nucleotides)
@@ -82,13 +101,14 @@ bool StandardBaseTemplates::template_exists(core::typing::BaseType type) const {
     return std::filesystem::exists(template_file) && std::filesystem::is_regular_file(template_file);
 }
 
-core::Structure StandardBaseTemplates::load_template(core::typing::BaseType type, bool is_modified) {
-    // Create cache key that includes is_modified
+core::typing::BaseType StandardBaseTemplates::cache_key(core::typing::BaseType type, bool is_modified) {
     // Use a simple encoding: type * 2 + is_modified
-    auto cache_key = static_cast<core::typing::BaseType>(static_cast<int>(type) * 2 + (is_modified ? 1 : 0));
+    return static_cast<core::typing::BaseType>(static_cast<int>(type) * 2 + (is_modified ? 1 : 0));
+}
 
-    // Check cache first
-    auto it = cache_.find(cache_key);
+const core::Structure& StandardBaseTemplates::load_template_locked(core::typing::BaseType type, bool is_modified) {
+    const auto key = cache_key(type, is_modified);
+    auto it = cache_.find(key);
     if (it != cache_.end() && it->second) {
         return *(it->second);
     }
@@ -102,12 +122,44 @@ core::Structure StandardBaseTemplates::load_template(core::typing::BaseType type
 
     // Load template using PDB parser
     io::PdbParser parser;
-    core::Structure template_structure = parser.parse_file(template_file);
+    auto template_structure = std::make_shared<core::Structure>(parser.parse_file(template_file));
 
     // Cache the template
-    cache_[cache_key] = std::make_shared<core::Structure>(template_structure);
+    cache_[key] = template_structure;
+    return *template_structure;
+}
+
+core::Structure StandardBaseTemplates::load_template(core::typing::BaseType type, bool is_modified) {
+    // A miss is loaded under the lock so each template is parsed once
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return load_template_locked(type, is_modified);
+}
+
+const RingTemplate& StandardBaseTemplates::ring_template(core::typing::BaseType type, bool is_modified) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    const auto key = cache_key(type, is_modified);
+    auto it = ring_cache_.find(key);
+    if (it != ring_cache_.end()) {
+        return *(it->second);
+    }
+
+    const core::Structure& structure = load_template_locked(type, is_modified);
+    auto ring = std::make_shared<RingTemplate>();
+    ring->file = get_template_path(type, is_modified);
+    for (const auto& chain : structure.chains()) {
+        for (const auto& residue : chain.residues()) {
+            for (const auto& atom : residue.atoms()) {
+                const auto slot = static_cast<size_t>(atom.atom_type());
+                if (core::typing::is_ring_atom(atom.atom_type()) && !ring->present[slot]) {
+                    ring->coords[slot] = atom.position();
+                    ring->present[slot] = true;
+                }
+            }
+        }
+    }
 
-    return template_structure;
+    ring_cache_[key] = ring;
+    return *ring;
 }
 
 // Backwards compatible version
@@ -125,7 +177,9 @@ void StandardBaseTemplates::set_template_path(const std::filesystem::path& templ
 }
 
 void StandardBaseTemplates::clear_cache() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
     cache_.clear();
+    ring_cache_.clear();
 }
 
 bool StandardBaseTemplates::file_exists(const std::filesystem::path& path) {
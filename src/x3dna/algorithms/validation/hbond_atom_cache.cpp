@@ -0,0 +1,27 @@
+/**
+ * @file hbond_atom_cache.cpp
+ * @brief Implementation of HBondAtomCache
+ */
+
+#include <x3dna/algorithms/validation/hbond_atom_cache.hpp>
+
+namespace x3dna {
+namespace algorithms {
+namespace validation {
+
+void HBondAtomCache::build(const std::vector<const core::Residue*>& residues,
+                           const hydrogen_bond::HBondDetector& detector) {
+    data_.clear();
+    data_.reserve(residues.size());
+    for (const auto* residue : residues) {
+        data_.push_back(detector.index_atoms(*residue));
+    }
+}
+
+void HBondAtomCache::clear() {
+    data_.clear();
+}
+
+} // namespace validation
+} // namespace algorithms
+} // namespace x3dna
@@ -19,7 +19,9 @@
 #include <x3dna/core/atom.hpp>
 #include <x3dna/core/typing/atom_type.hpp>
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <optional>
 
 namespace x3dna {
 namespace algorithms {
@@ -321,25 +323,28 @@ std::vector<geometry::Vector3D> extract_ring_coordinates(const ResidueType& resi
 // ============================================================================
 
 /**
- * @brief Project 3D ring coordinates onto 2D plane perpendicular to average z-axis
- * @param ring_coords_3d Vector of 3D ring coordinates
- * @param average_z_axis The average z-axis of the two base pair reference frames
- * @return Vector of 2D points representing the projected polygon
- *
- * Constructs an orthonormal basis where the z-axis is the given average_z_axis,
- * then projects all 3D coordinates onto the xy-plane of this basis.
+ * @brief Orthonormal in-plane axes for projecting onto the plane perpendicular to a z-axis
  */
-std::vector<Point2D> project_to_base_plane(const std::vector<geometry::Vector3D>& ring_coords_3d,
-                                            const geometry::Vector3D& average_z_axis) {
-    std::vector<Point2D> projected_points;
-    projected_points.reserve(ring_coords_3d.size());
+struct PlaneBasis {
+    geometry::Vector3D z_unit;
+    geometry::Vector3D x_axis;
+    geometry::Vector3D y_axis;
+    bool aligned = false; // z_unit is the global z-axis: use x and y directly
+};
 
+/**
+ * @brief Build the projection basis for an average z-axis
+ * @return std::nullopt if the axis is too short to normalize
+ */
+std::optional<PlaneBasis> make_plane_basis(const geometry::Vector3D& average_z_axis) {
     // Normalize z-axis
     double z_length = average_z_axis.length();
     if (z_length < 1e-10) {
-        return projected_points;  // Invalid z-axis
+        return std::nullopt;  // Invalid z-axis
     }
-    geometry::Vector3D z_unit = average_z_axis / z_length;
+    PlaneBasis basis;
+    basis.z_unit = average_z_axis / z_length;
+    const geometry::Vector3D& z_unit = basis.z_unit;
 
     // Check if z-axis is already aligned with global z
     geometry::Vector3D global_z(0.0, 0.0, 1.0);
@@ -347,48 +352,94 @@ std::vector<Point2D> project_to_base_plane(const std::vector<geometry::Vector3D>
     double alignment_angle = std::acos(std::max(-1.0, std::min(1.0, alignment)));
 
     if (alignment_angle < 1e-6) {
-        // Already aligned with global z - use x,y coordinates directly
-        for (const auto& coord : ring_coords_3d) {
-            projected_points.push_back({coord.x(), coord.y()});
-        }
+        basis.aligned = true;
+        return basis;
+    }
+
+    // Build orthonormal basis for projection
+    geometry::Vector3D x_axis;
+
+    // Choose initial x-axis not parallel to z
+    if (std::abs(z_unit.x()) < 0.9) {
+        x_axis = geometry::Vector3D(1.0, 0.0, 0.0);
     } else {
-        // Build orthonormal basis for projection
-        geometry::Vector3D x_axis;
-
-        // Choose initial x-axis not parallel to z
-        if (std::abs(z_unit.x()) < 0.9) {
-            x_axis = geometry::Vector3D(1.0, 0.0, 0.0);
-        } else {
-            x_axis = geometry::Vector3D(0.0, 1.0, 0.0);
-        }
+        x_axis = geometry::Vector3D(0.0, 1.0, 0.0);
+    }
 
-        // Gram-Schmidt: make x_axis orthogonal to z_unit
-        x_axis = x_axis - z_unit * x_axis.dot(z_unit);
-        double x_length = x_axis.length();
-        if (x_length > 1e-10) {
-            x_axis = x_axis / x_length;
-        } else {
-            x_axis = geometry::Vector3D(1.0, 0.0, 0.0);
-        }
+    // Gram-Schmidt: make x_axis orthogonal to z_unit
+    x_axis = x_axis - z_unit * x_axis.dot(z_unit);
+    double x_length = x_axis.length();
+    if (x_length > 1e-10) {
+        x_axis = x_axis / x_length;
+    } else {
+        x_axis = geometry::Vector3D(1.0, 0.0, 0.0);
+    }
 
-        // y_axis completes the right-handed basis
-        geometry::Vector3D y_axis = z_unit.cross(x_axis);
-        double y_length = y_axis.length();
-        if (y_length > 1e-10) {
-            y_axis = y_axis / y_length;
-        }
+    // y_axis completes the right-handed basis
+    geometry::Vector3D y_axis = z_unit.cross(x_axis);
+    double y_length = y_axis.length();
+    if (y_length > 1e-10) {
+        y_axis = y_axis / y_length;
+    }
 
-        // Project each coordinate onto the xy-plane
-        for (const auto& coord : ring_coords_3d) {
-            double x_projected = coord.dot(x_axis);
-            double y_projected = coord.dot(y_axis);
-            projected_points.push_back({x_projected, y_projected});
-        }
+    basis.x_axis = x_axis;
+    basis.y_axis = y_axis;
+    return basis;
+}
+
+/**
+ * @brief Project one coordinate (already relative to the average origin) onto the base plane
+ */
+Point2D project_point(const PlaneBasis& basis, const geometry::Vector3D& coord) {
+    if (basis.aligned) {
+        return {coord.x(), coord.y()};
     }
+    return {coord.dot(basis.x_axis), coord.dot(basis.y_axis)};
+}
 
+/**
+ * @brief Project 3D ring coordinates onto 2D plane perpendicular to average z-axis
+ * @param ring_coords_3d Vector of 3D ring coordinates
+ * @param average_z_axis The average z-axis of the two base pair reference frames
+ * @return Vector of 2D points representing the projected polygon
+ *
+ * Constructs an orthonormal basis where the z-axis is the given average_z_axis,
+ * then projects all 3D coordinates onto the xy-plane of this basis.
+ */
+std::vector<Point2D> project_to_base_plane(const std::vector<geometry::Vector3D>& ring_coords_3d,
+                                            const geometry::Vector3D& average_z_axis) {
+    std::vector<Point2D> projected_points;
+    const auto basis = make_plane_basis(average_z_axis);
+    if (!basis) {
+        return projected_points;
+    }
+    projected_points.reserve(ring_coords_3d.size());
+    for (const auto& coord : ring_coords_3d) {
+        projected_points.push_back(project_point(*basis, coord));
+    }
     return projected_points;
 }
 
+/**
+ * @brief Check whether the bounding boxes of two polygons are apart by more than a margin
+ */
+bool bounding_boxes_separated(const Point2D* polygon_a, size_t count_a, const Point2D* polygon_b, size_t count_b,
+                              double margin) {
+    auto bounds = [](const Point2D* polygon, size_t count) {
+        std::array<double, 4> box = {polygon[0].x, polygon[0].x, polygon[0].y, polygon[0].y};
+        for (size_t i = 1; i < count; ++i) {
+            box[0] = std::min(box[0], polygon[i].x);
+            box[1] = std::max(box[1], polygon[i].x);
+            box[2] = std::min(box[2], polygon[i].y);
+            box[3] = std::max(box[3], polygon[i].y);
+        }
+        return box;
+    };
+    const auto a = bounds(polygon_a, count_a);
+    const auto b = bounds(polygon_b, count_b);
+    return a[1] + margin < b[0] || b[1] + margin < a[0] || a[3] + margin < b[2] || b[3] + margin < a[2];
+}
+
 /**
  * @brief Core overlap calculation given 3D ring coordinates
  * @tparam ResidueType Type supporting find_atom_ptr() and atoms() methods
@@ -435,26 +486,47 @@ double OverlapCalculator::calculate(const core::Residue& res1, const core::Resid
     return compute_overlap_area(res1, res2, average_origin, average_z_axis);
 }
 
-double OverlapCalculator::calculate(const core::Residue& res1, const core::Residue& res2,
+double OverlapCalculator::calculate(const ResidueRingData& ring1, const ResidueRingData& ring2,
                                     const geometry::Vector3D& average_origin,
-                                    const geometry::Vector3D& average_z_axis,
-                                    RingDataCache& cache) {
-    // Use cached ring data for faster repeated lookups
-    std::vector<geometry::Vector3D> ring_coords_1 = cache.get_ring_coords(res1, average_origin);
-    std::vector<geometry::Vector3D> ring_coords_2 = cache.get_ring_coords(res2, average_origin);
+                                    const geometry::Vector3D& average_z_axis) {
+    const size_t count_1 = ring1.polygon_positions.size();
+    const size_t count_2 = ring2.polygon_positions.size();
+    if (count_1 < 3 || count_2 < 3) {
+        return 0.0;
+    }
 
-    if (ring_coords_1.size() < 3 || ring_coords_2.size() < 3) {
+    const auto basis = make_plane_basis(average_z_axis);
+    if (!basis) {
         return 0.0;
     }
 
-    std::vector<Point2D> polygon_1 = project_to_base_plane(ring_coords_1, average_z_axis);
-    std::vector<Point2D> polygon_2 = project_to_base_plane(ring_coords_2, average_z_axis);
+    // Bounding circles: projection never lengthens a distance, so polygons whose spheres are
+    // apart in the plane cannot overlap. The margin dwarfs rounding in this test and in the
+    // integer scaling of calculate_polygon_intersection, which returns exactly 0 for such pairs.
+    const geometry::Vector3D center_offset = ring1.polygon_center - ring2.polygon_center;
+    const double along_z = center_offset.dot(basis->z_unit);
+    const double in_plane_sq = center_offset.dot(center_offset) - along_z * along_z;
+    const double reach = ring1.polygon_radius + ring2.polygon_radius + SEPARATION_MARGIN;
+    if (in_plane_sq > reach * reach) {
+        return 0.0;
+    }
 
-    if (polygon_1.size() < 3 || polygon_2.size() < 3) {
+    // Same arithmetic as project_to_base_plane(ring_coords(average_origin), average_z_axis)
+    std::array<Point2D, NUM_RING_ATOM_TYPES> polygon_1;
+    std::array<Point2D, NUM_RING_ATOM_TYPES> polygon_2;
+    for (size_t i = 0; i < count_1; ++i) {
+        polygon_1[i] = project_point(*basis, ring1.polygon_positions[i] - average_origin);
+    }
+    for (size_t i = 0; i < count_2; ++i) {
+        polygon_2[i] = project_point(*basis, ring2.polygon_positions[i] - average_origin);
+    }
+
+    if (bounding_boxes_separated(polygon_1.data(), count_1, polygon_2.data(), count_2, SEPARATION_MARGIN)) {
         return 0.0;
     }
 
-    return calculate_polygon_intersection(polygon_1, polygon_2);
+    return polygon_intersection_area(polygon_1.data(), static_cast<long>(count_1), polygon_2.data(),
+                                     static_cast<long>(count_2));
 }
 
 std::vector<geometry::Vector3D> OverlapCalculator::get_ring_coordinates_with_exocyclic(
@@ -464,13 +536,16 @@ std::vector<geometry::Vector3D> OverlapCalculator::get_ring_coordinates_with_exo
 
 double OverlapCalculator::calculate_polygon_intersection(const std::vector<Point2D>& polygon_a,
                                                          const std::vector<Point2D>& polygon_b) {
-    if (polygon_a.size() < 3 || polygon_b.size() < 3) {
+    return polygon_intersection_area(polygon_a.data(), static_cast<long>(polygon_a.size()), polygon_b.data(),
+                                     static_cast<long>(polygon_b.size()));
+}
+
+double OverlapCalculator::polygon_intersection_area(const Point2D* polygon_a, long num_vertices_a,
+                                                    const Point2D* polygon_b, long num_vertices_b) {
+    if (num_vertices_a < 3 || num_vertices_b < 3) {
         return 0.0;
     }
 
-    const long num_vertices_a = static_cast<long>(polygon_a.size());
-    const long num_vertices_b = static_cast<long>(polygon_b.size());
-
     // Compute bounding box of both polygons
     double min_x = validation_constants::XBIG;
     double min_y = validation_constants::XBIG;
@@ -507,18 +582,28 @@ double OverlapCalculator::calculate_polygon_intersection(const std::vector<Point
         return 0.0;
     }
 
-    // Allocate scaled vertex arrays (+1 for wraparound to first vertex)
-    std::vector<PolygonVertex> scaled_polygon_a(num_vertices_a + 1);
-    std::vector<PolygonVertex> scaled_polygon_b(num_vertices_b + 1);
+    // Scaled vertex arrays (+1 for wraparound to first vertex); base polygons fit on the stack
+    std::array<PolygonVertex, STACK_POLYGON_VERTICES + 1> stack_a;
+    std::array<PolygonVertex, STACK_POLYGON_VERTICES + 1> stack_b;
+    std::vector<PolygonVertex> heap_a;
+    std::vector<PolygonVertex> heap_b;
+    if (num_vertices_a > STACK_POLYGON_VERTICES) {
+        heap_a.resize(num_vertices_a + 1);
+    }
+    if (num_vertices_b > STACK_POLYGON_VERTICES) {
+        heap_b.resize(num_vertices_b + 1);
+    }
+    PolygonVertex* scaled_polygon_a = heap_a.empty() ? stack_a.data() : heap_a.data();
+    PolygonVertex* scaled_polygon_b = heap_b.empty() ? stack_b.data() : heap_b.data();
 
     // Scale polygons to integer coordinates
     // Fudge bits (0 vs 2) provide numerical separation between the two polygons
     scale_polygon_to_integer_coords(min_x, min_y, scale_midpoint, scale_x, scale_y,
-                                    polygon_a.data(), num_vertices_a,
-                                    scaled_polygon_a.data(), 0);
+                                    polygon_a, num_vertices_a,
+                                    scaled_polygon_a, 0);
     scale_polygon_to_integer_coords(min_x, min_y, scale_midpoint, scale_x, scale_y,
-                                    polygon_b.data(), num_vertices_b,
-                                    scaled_polygon_b.data(), 2);
+                                    polygon_b, num_vertices_b,
+                                    scaled_polygon_b, 2);
 
     // Find all edge-edge intersections and accumulate area
     double intersection_area = 0.0;
@@ -574,11 +659,11 @@ double OverlapCalculator::calculate_polygon_intersection(const std::vector<Point
 
     // Add contributions from vertices inside the other polygon
     add_interior_vertex_contributions(intersection_area,
-                                      scaled_polygon_a.data(), num_vertices_a,
-                                      scaled_polygon_b.data(), num_vertices_b);
+                                      scaled_polygon_a, num_vertices_a,
+                                      scaled_polygon_b, num_vertices_b);
     add_interior_vertex_contributions(intersection_area,
-                                      scaled_polygon_b.data(), num_vertices_b,
-                                      scaled_polygon_a.data(), num_vertices_a);
+                                      scaled_polygon_b, num_vertices_b,
+                                      scaled_polygon_a, num_vertices_a);
 
     // Convert area back from scaled coordinates
     if (std::isnan(inverse_scale) || std::isinf(inverse_scale) || inverse_scale == 0.0) {
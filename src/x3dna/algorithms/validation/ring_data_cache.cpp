@@ -6,6 +6,7 @@
 #include <x3dna/algorithms/validation/ring_data_cache.hpp>
 #include <x3dna/algorithms/validation_constants.hpp>
 #include <x3dna/core/typing/atom_type.hpp>
+#include <algorithm>
 
 namespace x3dna {
 namespace algorithms {
@@ -15,43 +16,28 @@ using core::AtomType;
 using core::RING_ATOM_TYPES;
 using core::NUM_RING_ATOM_TYPES;
 
-const ResidueRingData& RingDataCache::get_or_compute(const core::Residue& residue) {
-    const std::string& key = residue.res_id();
-
-    auto it = cache_.find(key);
-    if (it != cache_.end()) {
-        return it->second;
+void RingDataCache::build(const std::vector<const core::Residue*>& residues) {
+    data_.clear();
+    data_.reserve(residues.size());
+    for (const auto* residue : residues) {
+        data_.push_back(ResidueRingData::compute(*residue));
     }
-
-    // Compute and cache
-    auto result = cache_.emplace(key, compute_ring_data(residue));
-    return result.first->second;
 }
 
-std::vector<geometry::Vector3D> RingDataCache::get_ring_coords(const core::Residue& residue,
-                                                                const geometry::Vector3D& oave) {
-    const auto& data = get_or_compute(residue);
+void RingDataCache::clear() {
+    data_.clear();
+}
 
+std::vector<geometry::Vector3D> ResidueRingData::ring_coords(const geometry::Vector3D& oave) const {
     std::vector<geometry::Vector3D> coords;
-    coords.reserve(data.ring_atom_indices.size());
-
-    const auto& atoms = residue.atoms();
-
-    for (size_t i = 0; i < data.ring_atom_indices.size(); ++i) {
-        size_t exo_idx = data.exocyclic_atom_indices[i];
-        if (exo_idx < atoms.size()) {
-            coords.push_back(atoms[exo_idx].position() - oave);
-        }
+    coords.reserve(polygon_positions.size());
+    for (const auto& position : polygon_positions) {
+        coords.push_back(position - oave);
     }
-
     return coords;
 }
 
-void RingDataCache::clear() {
-    cache_.clear();
-}
-
-ResidueRingData RingDataCache::compute_ring_data(const core::Residue& residue) {
+ResidueRingData ResidueRingData::compute(const core::Residue& residue) {
     ResidueRingData data;
 
     const auto& atoms = residue.atoms();
@@ -104,6 +90,17 @@ ResidueRingData RingDataCache::compute_ring_data(const core::Residue& residue) {
         }
 
         data.exocyclic_atom_indices.push_back(best_exo_idx);
+        data.polygon_positions.push_back(atoms[best_exo_idx].position());
+    }
+
+    // Bounding sphere of the polygon, for overlap early exits
+    geometry::Vector3D sum(0.0, 0.0, 0.0);
+    for (const auto& position : data.polygon_positions) {
+        sum = sum + position;
+    }
+    data.polygon_center = sum / static_cast<double>(data.polygon_positions.size());
+    for (const auto& position : data.polygon_positions) {
+        data.polygon_radius = std::max(data.polygon_radius, (position - data.polygon_center).length());
     }
 
     return data;
@@ -15,6 +15,7 @@ namespace config {
 // Static member initialization
 std::optional<HBondParameters> HBondParametersLoader::cached_params_;
 nlohmann::json HBondParametersLoader::cached_json_;
+std::recursive_mutex HBondParametersLoader::cache_mutex_;
 
 HBondParameters HBondParameters::defaults() {
     return HBondParameters{};
@@ -55,7 +56,10 @@ HBondParameters HBondParametersLoader::load_from_file(const std::filesystem::pat
     }
 
     // Cache the JSON for preset loading
-    cached_json_ = json;
+    {
+        std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+        cached_json_ = json;
+    }
 
     return load_from_json(json);
 }
@@ -198,6 +202,8 @@ void HBondParametersLoader::load_quality_tiers(QualityTiersConfig& config, const
 }
 
 HBondParameters HBondParametersLoader::load_preset(const std::string& preset_name) {
+    std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+
     // Ensure we have the JSON loaded
     if (cached_json_.empty()) {
         load();  // This populates cached_json_
@@ -237,6 +243,8 @@ void HBondParametersLoader::apply_preset(HBondParameters& base, const nlohmann::
 }
 
 const HBondParameters& HBondParametersLoader::instance() {
+    std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+
     if (!cached_params_.has_value()) {
         cached_params_ = load();
     }
@@ -244,12 +252,16 @@ const HBondParameters& HBondParametersLoader::instance() {
 }
 
 void HBondParametersLoader::reload() {
+    std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+
     cached_params_.reset();
     cached_json_.clear();
     cached_params_ = load();
 }
 
 std::vector<std::string> HBondParametersLoader::available_presets() {
+    std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+
     // Ensure we have the JSON loaded
     if (cached_json_.empty()) {
         load();
@@ -268,6 +280,8 @@ std::vector<std::string> HBondParametersLoader::available_presets() {
 }
 
 bool HBondParametersLoader::has_preset(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(cache_mutex_);
+
     // Ensure we have the JSON loaded
     if (cached_json_.empty()) {
         load();
@@ -0,0 +1,74 @@
+/**
+ * @file interned_names.cpp
+ * @brief Implementation of InternedNames
+ */
+
+#include <x3dna/core/interned_names.hpp>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace x3dna {
+namespace core {
+
+namespace {
+
+struct InternState {
+    std::mutex mutex;
+    std::unordered_map<std::string, InternedNames::Id> ids;
+    size_t count = 0;
+};
+
+InternState& intern_state() {
+    static InternState state;
+    return state;
+}
+
+} // namespace
+
+InternedNames::Chunks InternedNames::make_chunks() {
+    // The first chunk always exists so that ID 0 (empty string) is valid without interning
+    Chunks chunks;
+    chunks[0] = std::make_unique<std::string[]>(CHUNK_SIZE);
+    return chunks;
+}
+
+InternedNames::Id InternedNames::intern(std::string_view name) {
+    if (name.empty()) {
+        return 0;
+    }
+
+    auto& state = intern_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.count == 0) {
+        state.ids.emplace(std::string(), 0);
+        state.count = 1;
+    }
+
+    std::string key(name);
+    auto it = state.ids.find(key);
+    if (it != state.ids.end()) {
+        return it->second;
+    }
+    if (state.count == MAX_NAMES) {
+        throw std::runtime_error("InternedNames: more than " + std::to_string(MAX_NAMES) + " distinct names");
+    }
+
+    const size_t id = state.count++;
+    auto& chunk = chunks()[id >> CHUNK_BITS];
+    if (!chunk) {
+        chunk = std::make_unique<std::string[]>(CHUNK_SIZE);
+    }
+    chunk[id & CHUNK_MASK] = key;
+    state.ids.emplace(std::move(key), static_cast<Id>(id));
+    return static_cast<Id>(id);
+}
+
+size_t InternedNames::size() {
+    auto& state = intern_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.count == 0 ? 1 : state.count;
+}
+
+} // namespace core
+} // namespace x3dna
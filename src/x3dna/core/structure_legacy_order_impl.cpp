@@ -3,34 +3,68 @@
  * @brief Implementation of legacy order methods for Structure class
  *
  * Uses stored legacy_residue_idx values instead of recomputing from atoms.
+ * The order and index table are built once per structure and cached.
  */
 
 #include <x3dna/core/structure.hpp>
 #include <x3dna/core/structure_legacy_order.hpp>
 #include <algorithm>
+#include <memory>
 
 namespace x3dna {
 namespace core {
 
-std::vector<const Residue*> Structure::residues_in_legacy_order() const {
-    return ::x3dna::core::get_residues_in_legacy_order(*this);
-}
-
-const Residue* Structure::get_residue_by_legacy_idx(int legacy_idx) const {
-    if (legacy_idx < 1) {
-        return nullptr;
+const Structure::LegacyIndex& Structure::legacy_index() const {
+    if (auto index = legacy_index_.load()) {
+        return *index;
     }
 
-    // Search for residue with matching legacy_residue_idx
+    // Collect all residues with their legacy indices
+    auto built = std::make_shared<LegacyIndex>();
+    std::vector<std::pair<int, const Residue*>> indexed_residues;
+    int max_idx = 0;
     for (const auto& chain : chains_) {
         for (const auto& residue : chain.residues()) {
-            if (residue.legacy_residue_idx() == legacy_idx) {
-                return &residue;
+            const int legacy_idx = residue.legacy_residue_idx();
+            if (legacy_idx > 0) {
+                indexed_residues.push_back({legacy_idx, &residue});
+                max_idx = std::max(max_idx, legacy_idx);
             }
         }
     }
 
-    return nullptr;
+    // Dense index table; on duplicates the first residue in chain order wins
+    built->by_index.assign(static_cast<size_t>(max_idx) + 1, nullptr);
+    for (const auto& [idx, res] : indexed_residues) {
+        if (!built->by_index[idx]) {
+            built->by_index[idx] = res;
+        }
+    }
+
+    // Sort by legacy_residue_idx
+    std::stable_sort(indexed_residues.begin(), indexed_residues.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    built->order.reserve(indexed_residues.size());
+    for (const auto& [idx, res] : indexed_residues) {
+        built->order.push_back(res);
+    }
+
+    std::shared_ptr<const LegacyIndex> index = std::move(built);
+    legacy_index_.publish(index);
+    return *index;
+}
+
+const std::vector<const Residue*>& Structure::residues_in_legacy_order() const {
+    return legacy_index().order;
+}
+
+const Residue* Structure::get_residue_by_legacy_idx(int legacy_idx) const {
+    if (legacy_idx < 1) {
+        return nullptr;
+    }
+
+    const auto& by_index = legacy_index().by_index;
+    return static_cast<size_t>(legacy_idx) < by_index.size() ? by_index[legacy_idx] : nullptr;
 }
 
 int Structure::get_legacy_idx_for_residue(const Residue* residue) const {
@@ -0,0 +1,151 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementation of ThreadPool
+ */
+
+#include <x3dna/core/thread_pool.hpp>
+#include <algorithm>
+
+namespace x3dna {
+namespace core {
+
+ThreadPool::ThreadPool(size_t num_threads) {
+    const size_t count = num_threads == 0 ? resolve_thread_count(0) : num_threads;
+    queues_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    threads_.reserve(count - 1);
+    for (size_t worker = 1; worker < count; ++worker) {
+        threads_.emplace_back([this, worker]() { worker_loop(worker); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::resolve_thread_count(int requested) {
+    if (requested > 0) {
+        return static_cast<size_t>(requested);
+    }
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::parallel_for(size_t num_tasks, const TaskFunction& fn) {
+    if (num_tasks == 0) {
+        return;
+    }
+    if (threads_.empty() || num_tasks == 1) {
+        for (size_t task = 0; task < num_tasks; ++task) {
+            fn(task, 0);
+        }
+        return;
+    }
+
+    // Deal contiguous blocks so neighboring tasks (often similar cost) start on the same worker
+    const size_t workers = queues_.size();
+    const size_t block = (num_tasks + workers - 1) / workers;
+    for (size_t worker = 0; worker < workers; ++worker) {
+        std::lock_guard<std::mutex> lock(queues_[worker]->mutex);
+        for (size_t task = worker * block; task < std::min(num_tasks, (worker + 1) * block); ++task) {
+            queues_[worker]->tasks.push_back(task);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &fn;
+        active_workers_ = threads_.size();
+        ++generation_;
+    }
+    work_cv_.notify_all();
+
+    run_tasks(0, fn);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return active_workers_ == 0; });
+        job_ = nullptr;
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        std::swap(error, error_);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::worker_loop(size_t worker) {
+    size_t seen_generation = 0;
+    while (true) {
+        const TaskFunction* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [&]() { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) {
+                return;
+            }
+            seen_generation = generation_;
+            job = job_;
+        }
+
+        run_tasks(worker, *job);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --active_workers_;
+        }
+        done_cv_.notify_one();
+    }
+}
+
+void ThreadPool::run_tasks(size_t worker, const TaskFunction& fn) {
+    size_t task = 0;
+    while (pop_task(worker, task)) {
+        try {
+            fn(task, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+        }
+    }
+}
+
+bool ThreadPool::pop_task(size_t worker, size_t& task) {
+    // Own queue first (front), then steal from others (back)
+    {
+        WorkQueue& own = *queues_[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.front();
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        WorkQueue& victim = *queues_[(worker + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace core
+} // namespace x3dna
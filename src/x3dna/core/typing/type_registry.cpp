@@ -4,6 +4,7 @@
  */
 
 #include "x3dna/core/typing/type_registry.hpp"
+#include "x3dna/core/typing/typing_tables_generated.hpp"
 #include "x3dna/config/resource_locator.hpp"
 
 #include <nlohmann/json.hpp>
@@ -29,6 +30,12 @@ std::set<std::string>& get_warned_residues() {
     return warned;
 }
 
+// Lookups may run on worker threads (parallel pair validation)
+std::mutex& get_warned_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
 // Helper to convert string to BaseType
 BaseType string_to_base_type(const std::string& type_str) {
     if (type_str == "ADENINE") return BaseType::ADENINE;
@@ -41,6 +48,40 @@ BaseType string_to_base_type(const std::string& type_str) {
     return BaseType::UNKNOWN;
 }
 
+// Fill the nucleotide fields of a classification
+void set_nucleotide(ResidueClassification& result, const std::string& residue_name, char one_letter_code,
+                    BaseType base_type, bool is_purine) {
+    result.molecule_type = MoleculeType::NUCLEIC_ACID;
+    result.one_letter_code = one_letter_code;
+    result.base_type = base_type;
+    result.is_modified_nucleotide = std::islower(static_cast<unsigned char>(one_letter_code));
+
+    // Determine RNA vs DNA
+    bool is_dna = (residue_name.size() >= 2 && residue_name[0] == 'D') || residue_name == "T" || residue_name == "THY";
+    result.nucleic_acid_type = is_dna ? NucleicAcidType::DNA : NucleicAcidType::RNA;
+
+    // Set category
+    result.base_category = is_purine ? BaseCategory::PURINE : BaseCategory::PYRIMIDINE;
+
+    // Set canonical code
+    switch (base_type) {
+        case BaseType::ADENINE: result.canonical_code = 'A'; break;
+        case BaseType::GUANINE: result.canonical_code = 'G'; break;
+        case BaseType::CYTOSINE: result.canonical_code = 'C'; break;
+        case BaseType::THYMINE: result.canonical_code = 'T'; break;
+        case BaseType::URACIL: result.canonical_code = 'U'; break;
+        case BaseType::INOSINE: result.canonical_code = 'I'; break;
+        case BaseType::PSEUDOURIDINE: result.canonical_code = 'U'; break;
+        default: result.canonical_code = '?'; break;
+    }
+}
+
+// Generated table entry with a kind flag set, or nullptr
+const tables::ResidueNameEntry* find_residue(const std::string& residue_name, uint8_t kind) {
+    const auto* entry = tables::find_residue_name(residue_name);
+    return (entry != nullptr && (entry->kinds & kind) != 0) ? entry : nullptr;
+}
+
 } // anonymous namespace
 
 const TypeRegistry& TypeRegistry::instance() {
@@ -51,8 +92,7 @@ const TypeRegistry& TypeRegistry::instance() {
 TypeRegistry::TypeRegistry() {
     load_nucleotides();
     load_amino_acids();
-    load_waters();
-    load_ions();
+    nucleotides_match_table_ = nucleotides_match_table();
 }
 
 void TypeRegistry::load_nucleotides() {
@@ -85,87 +125,32 @@ void TypeRegistry::load_nucleotides() {
 }
 
 void TypeRegistry::load_amino_acids() {
-    // Standard 20 amino acids
-    struct AAData {
-        const char* name;
-        char code;
-        AminoAcidType type;
-        AminoAcidCategory category;
-    };
-
-    static const AAData standard_aas[] = {
-        {"ALA", 'A', AminoAcidType::ALA, AminoAcidCategory::HYDROPHOBIC},
-        {"ARG", 'R', AminoAcidType::ARG, AminoAcidCategory::POSITIVE},
-        {"ASN", 'N', AminoAcidType::ASN, AminoAcidCategory::POLAR},
-        {"ASP", 'D', AminoAcidType::ASP, AminoAcidCategory::NEGATIVE},
-        {"CYS", 'C', AminoAcidType::CYS, AminoAcidCategory::POLAR},
-        {"GLN", 'Q', AminoAcidType::GLN, AminoAcidCategory::POLAR},
-        {"GLU", 'E', AminoAcidType::GLU, AminoAcidCategory::NEGATIVE},
-        {"GLY", 'G', AminoAcidType::GLY, AminoAcidCategory::HYDROPHOBIC},
-        {"HIS", 'H', AminoAcidType::HIS, AminoAcidCategory::POSITIVE},
-        {"ILE", 'I', AminoAcidType::ILE, AminoAcidCategory::HYDROPHOBIC},
-        {"LEU", 'L', AminoAcidType::LEU, AminoAcidCategory::HYDROPHOBIC},
-        {"LYS", 'K', AminoAcidType::LYS, AminoAcidCategory::POSITIVE},
-        {"MET", 'M', AminoAcidType::MET, AminoAcidCategory::HYDROPHOBIC},
-        {"PHE", 'F', AminoAcidType::PHE, AminoAcidCategory::HYDROPHOBIC},
-        {"PRO", 'P', AminoAcidType::PRO, AminoAcidCategory::HYDROPHOBIC},
-        {"SER", 'S', AminoAcidType::SER, AminoAcidCategory::POLAR},
-        {"THR", 'T', AminoAcidType::THR, AminoAcidCategory::POLAR},
-        {"TRP", 'W', AminoAcidType::TRP, AminoAcidCategory::HYDROPHOBIC},
-        {"TYR", 'Y', AminoAcidType::TYR, AminoAcidCategory::POLAR},
-        {"VAL", 'V', AminoAcidType::VAL, AminoAcidCategory::HYDROPHOBIC},
-        // Non-standard
-        {"SEC", 'U', AminoAcidType::SEC, AminoAcidCategory::POLAR},
-        {"PYL", 'O', AminoAcidType::PYL, AminoAcidCategory::POSITIVE},
-        // Ambiguous
-        {"ASX", 'B', AminoAcidType::ASX, AminoAcidCategory::UNKNOWN},
-        {"GLX", 'Z', AminoAcidType::GLX, AminoAcidCategory::UNKNOWN},
-        {"XLE", 'J', AminoAcidType::XLE, AminoAcidCategory::HYDROPHOBIC},
-        {"UNK", 'X', AminoAcidType::UNK, AminoAcidCategory::UNKNOWN},
-    };
-
-    for (const auto& aa : standard_aas) {
+    // Amino acids come from standard_types.json via the generated table
+    for (const auto& entry : tables::RESIDUE_NAMES) {
+        if ((entry.kinds & tables::RESIDUE_AMINO_ACID) == 0) {
+            continue;
+        }
         AminoAcidInfo info;
-        info.one_letter_code = aa.code;
-        info.type = aa.type;
-        info.category = aa.category;
+        info.one_letter_code = entry.amino_acid_code;
+        info.type = entry.amino_acid_type;
+        info.category = entry.amino_acid_category;
         info.is_modified = false;
-        amino_acids_[aa.name] = info;
+        amino_acids_[std::string(entry.name)] = info;
     }
 }
 
-void TypeRegistry::load_waters() {
-    water_names_ = {"HOH", "WAT", "H2O", "OH2", "SOL", "DOD"};
-}
-
-void TypeRegistry::load_ions() {
-    // Map residue names to ion types
-    ion_types_ = {
-        // Alkali metals
-        {"LI", IonType::LITHIUM},
-        {"NA", IonType::SODIUM},
-        {"K", IonType::POTASSIUM},
-        {"RB", IonType::RUBIDIUM},
-        {"CS", IonType::CESIUM},
-        // Alkaline earth
-        {"MG", IonType::MAGNESIUM},
-        {"CA", IonType::CALCIUM},
-        {"SR", IonType::STRONTIUM},
-        {"BA", IonType::BARIUM},
-        // Transition metals
-        {"MN", IonType::MANGANESE},
-        {"FE", IonType::IRON},
-        {"CO", IonType::COBALT},
-        {"NI", IonType::NICKEL},
-        {"CU", IonType::COPPER},
-        {"ZN", IonType::ZINC},
-        {"CD", IonType::CADMIUM},
-        // Halogens
-        {"F", IonType::FLUORIDE},
-        {"CL", IonType::CHLORIDE},
-        {"BR", IonType::BROMIDE},
-        // Note: I (iodide) conflicts with inosine, handled specially
-    };
+bool TypeRegistry::nucleotides_match_table() const {
+    if (nucleotides_.size() != tables::NUCLEOTIDE_COUNT) {
+        return false;
+    }
+    for (const auto& [name, info] : nucleotides_) {
+        const auto* entry = find_residue(name, tables::RESIDUE_NUCLEOTIDE);
+        if (entry == nullptr || entry->nucleotide_code != info.one_letter_code ||
+            entry->base_type != info.base_type || entry->is_purine != info.is_purine) {
+            return false;
+        }
+    }
+    return true;
 }
 
 ResidueClassification TypeRegistry::classify_residue(const std::string& residue_name) const {
@@ -173,63 +158,46 @@ ResidueClassification TypeRegistry::classify_residue(const std::string& residue_
     ResidueClassification result;
     result.residue_name = residue_name;
 
+    const auto* entry = tables::find_residue_name(residue_name);
+    const uint8_t kinds = entry != nullptr ? entry->kinds : 0;
+
     // Check for water first
-    if (water_names_.count(residue_name) > 0) {
+    if (kinds & tables::RESIDUE_WATER) {
         result.molecule_type = MoleculeType::WATER;
         result.solvent_type = SolventType::WATER;
         return result;
     }
 
     // Check nucleotides (takes priority over ions to handle I=inosine correctly)
-    auto nuc_it = nucleotides_.find(residue_name);
-    if (nuc_it != nucleotides_.end()) {
-        const auto& info = nuc_it->second;
-        result.molecule_type = MoleculeType::NUCLEIC_ACID;
-        result.one_letter_code = info.one_letter_code;
-        result.base_type = info.base_type;
-        result.is_modified_nucleotide = info.is_modified;
-
-        // Determine RNA vs DNA
-        bool is_dna = (residue_name.size() >= 2 && residue_name[0] == 'D') ||
-                      residue_name == "T" || residue_name == "THY";
-        result.nucleic_acid_type = is_dna ? NucleicAcidType::DNA : NucleicAcidType::RNA;
-
-        // Set category
-        result.base_category = info.is_purine ? BaseCategory::PURINE : BaseCategory::PYRIMIDINE;
-
-        // Set canonical code
-        switch (info.base_type) {
-            case BaseType::ADENINE: result.canonical_code = 'A'; break;
-            case BaseType::GUANINE: result.canonical_code = 'G'; break;
-            case BaseType::CYTOSINE: result.canonical_code = 'C'; break;
-            case BaseType::THYMINE: result.canonical_code = 'T'; break;
-            case BaseType::URACIL: result.canonical_code = 'U'; break;
-            case BaseType::INOSINE: result.canonical_code = 'I'; break;
-            case BaseType::PSEUDOURIDINE: result.canonical_code = 'U'; break;
-            default: result.canonical_code = '?'; break;
+    if (nucleotides_match_table_) {
+        if (kinds & tables::RESIDUE_NUCLEOTIDE) {
+            set_nucleotide(result, residue_name, entry->nucleotide_code, entry->base_type, entry->is_purine);
+            return result;
+        }
+    } else {
+        auto nuc_it = nucleotides_.find(residue_name);
+        if (nuc_it != nucleotides_.end()) {
+            const auto& info = nuc_it->second;
+            set_nucleotide(result, residue_name, info.one_letter_code, info.base_type, info.is_purine);
+            return result;
         }
-
-        return result;
     }
 
     // Check amino acids
-    auto aa_it = amino_acids_.find(residue_name);
-    if (aa_it != amino_acids_.end()) {
-        const auto& info = aa_it->second;
+    if (kinds & tables::RESIDUE_AMINO_ACID) {
         result.molecule_type = MoleculeType::PROTEIN;
-        result.amino_acid_type = info.type;
-        result.amino_acid_category = info.category;
-        result.one_letter_code = info.one_letter_code;
-        result.canonical_code = info.one_letter_code;
-        result.is_modified_amino_acid = info.is_modified;
+        result.amino_acid_type = entry->amino_acid_type;
+        result.amino_acid_category = entry->amino_acid_category;
+        result.one_letter_code = entry->amino_acid_code;
+        result.canonical_code = entry->amino_acid_code;
+        result.is_modified_amino_acid = false;
         return result;
     }
 
     // Check ions
-    auto ion_it = ion_types_.find(residue_name);
-    if (ion_it != ion_types_.end()) {
+    if (kinds & tables::RESIDUE_ION) {
         result.molecule_type = MoleculeType::ION;
-        result.ion_type = ion_it->second;
+        result.ion_type = entry->ion_type;
         return result;
     }
 
@@ -239,18 +207,21 @@ ResidueClassification TypeRegistry::classify_residue(const std::string& residue_
 }
 
 bool TypeRegistry::is_water(const std::string& residue_name) const {
-    return water_names_.count(residue_name) > 0;
+    return find_residue(residue_name, tables::RESIDUE_WATER) != nullptr;
 }
 
 bool TypeRegistry::is_ion(const std::string& residue_name) const {
-    return ion_types_.count(residue_name) > 0;
+    return find_residue(residue_name, tables::RESIDUE_ION) != nullptr;
 }
 
 bool TypeRegistry::is_amino_acid(const std::string& residue_name) const {
-    return amino_acids_.count(residue_name) > 0;
+    return find_residue(residue_name, tables::RESIDUE_AMINO_ACID) != nullptr;
 }
 
 bool TypeRegistry::is_nucleotide(const std::string& residue_name) const {
+    if (nucleotides_match_table_) {
+        return find_residue(residue_name, tables::RESIDUE_NUCLEOTIDE) != nullptr;
+    }
     return nucleotides_.count(residue_name) > 0;
 }
 
@@ -277,6 +248,7 @@ char TypeRegistry::get_one_letter_code(const std::string& residue_name) const {
     // Only warn for residues that might be nucleotides (not water, ions, amino acids, ligands)
     // Check if it's a known non-nucleotide type
     if (!is_water(residue_name) && !is_ion(residue_name) && !is_amino_acid(residue_name)) {
+        std::lock_guard<std::mutex> lock(get_warned_mutex());
         auto& warned = get_warned_residues();
         if (warned.find(residue_name) == warned.end()) {
             warned.insert(residue_name);
@@ -305,11 +277,8 @@ std::optional<AminoAcidInfo> TypeRegistry::get_amino_acid_info(const std::string
 }
 
 IonType TypeRegistry::get_ion_type(const std::string& residue_name) const {
-    auto it = ion_types_.find(residue_name);
-    if (it != ion_types_.end()) {
-        return it->second;
-    }
-    return IonType::UNKNOWN;
+    const auto* entry = find_residue(residue_name, tables::RESIDUE_ION);
+    return entry != nullptr ? entry->ion_type : IonType::UNKNOWN;
 }
 
 } // namespace typing
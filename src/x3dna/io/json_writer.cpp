@@ -218,7 +218,7 @@ void JsonWriter::record_pdb_atoms(const core::Structure& structure) {
 
 void JsonWriter::record_residue_indices(const core::Structure& structure) {
     // Get residues in legacy order (PDB file order, grouped by ResName+ChainID+ResSeq+insertion)
-    auto residues = structure.residues_in_legacy_order();
+    const auto& residues = structure.residues_in_legacy_order();
 
     if (residues.empty()) {
         return;
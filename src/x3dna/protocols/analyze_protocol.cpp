@@ -96,6 +96,7 @@ void AnalyzeProtocol::recalculate_frames(core::Structure& structure) {
         }
 
         frame_calculator_.set_is_rna(is_rna);
+        frame_calculator_.set_num_threads(config_.num_threads);
         frame_calculator_.calculate_all_frames(structure);
 
         if (frames_found > 0) {
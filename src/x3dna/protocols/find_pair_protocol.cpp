@@ -6,6 +6,7 @@
 #include <x3dna/protocols/find_pair_protocol.hpp>
 #include <x3dna/config/config_manager.hpp>
 #include <x3dna/io/json_writer.hpp>
+#include <x3dna/algorithms/pair_identification/nucleotide_eligibility.hpp>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/core/nucleotide_utils.hpp>
 #include <iostream>
@@ -54,6 +55,7 @@ void FindPairProtocol::calculate_frames(core::Structure& structure) {
     }
 
     frame_calculator_.set_is_rna(is_rna);
+    frame_calculator_.set_num_threads(config_.num_threads);
     frame_calculator_.calculate_all_frames(structure);
 
     // Note: Frame calculation recording to JSON is typically done manually
@@ -70,6 +72,8 @@ void FindPairProtocol::find_pairs(core::Structure& structure) {
         pair_finder_.set_strategy(algorithms::PairFindingStrategy::BEST_PAIR);
     }
 
+    pair_finder_.set_num_threads(config_.num_threads);
+
     // Find pairs (with JSON recording if writer provided)
     if (json_writer_) {
         base_pairs_ = pair_finder_.find_pairs_with_recording(structure, json_writer_);
@@ -98,26 +102,8 @@ size_t FindPairProtocol::write_frames_json(core::Structure& structure, const std
     }
 
     for (auto* residue : residues_in_order) {
-        // Only process nucleotide residues
-        bool is_nucleotide = residue->is_nucleotide();
-
-        // Check for modified nucleotides that have ring atoms
-        if (!is_nucleotide && residue->molecule_type() == core::typing::MoleculeType::UNKNOWN) {
-            // Check for common ring atoms using AtomType (O(1) comparison)
-            static constexpr core::AtomType common_ring_atoms[] = {
-                core::AtomType::C4, core::AtomType::N3, core::AtomType::C2,
-                core::AtomType::N1, core::AtomType::C6, core::AtomType::C5
-            };
-            int ring_atom_count = 0;
-            for (auto type : common_ring_atoms) {
-                if (residue->has_atom_type(type)) {
-                    ring_atom_count++;
-                }
-            }
-            if (ring_atom_count >= 3) {
-                is_nucleotide = true;
-            }
-        }
+        // Only process nucleotide residues, including modified ones that carry base ring atoms
+        const bool is_nucleotide = algorithms::NucleotideEligibility::has_base_ring(*residue);
 
         if (is_nucleotide) {
             // Get legacy_residue_idx from residue
@@ -9,8 +9,12 @@
 #include <x3dna/core/chain.hpp>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/core/atom.hpp>
+#include <x3dna/geometry/matrix3d.hpp>
 #include <x3dna/geometry/vector3d.hpp>
+#include <cstdio>
 #include <filesystem>
+#include <fstream>
+#include <string>
 
 using namespace x3dna::algorithms;
 using namespace x3dna::core;
@@ -123,6 +127,99 @@ TEST_F(BaseFrameCalculatorTest, CalculateAllFrames) {
     EXPECT_NO_THROW(calculator_->calculate_all_frames(structure));
 }
 
+// Sharded atom matching must give the same frames as the serial path
+TEST_F(BaseFrameCalculatorTest, CalculateAllFramesParallelMatchesSerial) {
+    Structure structure("TEST");
+    Chain chain("A");
+    for (int i = 0; i < 40; ++i) {
+        // Adenine rings stacked along z with a small per-residue twist
+        const double angle = 0.6 * i;
+        const Matrix3D twist = Matrix3D::rotation_z(angle);
+        const Vector3D rise(0.0, 0.0, 3.4 * i);
+        Residue residue("  A", i + 1, "A");
+        residue.add_atom(Atom(" C4 ", twist * Vector3D(-1.267, 3.124, 0.000) + rise));
+        residue.add_atom(Atom(" N3 ", twist * Vector3D(-2.320, 2.290, 0.000) + rise));
+        residue.add_atom(Atom(" C2 ", twist * Vector3D(-1.912, 1.023, 0.000) + rise));
+        residue.add_atom(Atom(" N1 ", twist * Vector3D(-0.668, 0.532, 0.000) + rise));
+        residue.add_atom(Atom(" C6 ", twist * Vector3D(0.369, 1.398, 0.000) + rise));
+        residue.add_atom(Atom(" C5 ", twist * Vector3D(0.071, 2.771, 0.000) + rise));
+        residue.add_atom(Atom(" N7 ", twist * Vector3D(0.877, 3.902, 0.000) + rise));
+        residue.add_atom(Atom(" C8 ", twist * Vector3D(0.024, 4.897, 0.000) + rise));
+        residue.add_atom(Atom(" N9 ", twist * Vector3D(-1.291, 4.498, 0.000) + rise));
+        chain.add_residue(residue);
+    }
+    structure.add_chain(chain);
+
+    Structure parallel = structure;
+    calculator_->calculate_all_frames(structure);
+    calculator_->set_num_threads(4);
+    calculator_->calculate_all_frames(parallel);
+
+    const auto serial_residues = structure.residues_in_legacy_order();
+    const auto parallel_residues = parallel.residues_in_legacy_order();
+    ASSERT_EQ(serial_residues.size(), parallel_residues.size());
+    for (size_t i = 0; i < serial_residues.size(); ++i) {
+        const auto expected = serial_residues[i]->reference_frame();
+        const auto actual = parallel_residues[i]->reference_frame();
+        ASSERT_EQ(expected.has_value(), actual.has_value()) << "residue " << i;
+        if (!expected.has_value()) {
+            continue;
+        }
+        EXPECT_EQ(expected->origin(), actual->origin()) << "residue " << i;
+        EXPECT_EQ(expected->rotation().as_array(), actual->rotation().as_array()) << "residue " << i;
+    }
+}
+
+// Assigning a calculator must also replace the ring templates it has already cached
+TEST_F(BaseFrameCalculatorTest, CopyAssignmentReplacesCachedRingTemplates) {
+    // Second template directory whose adenine is shifted 5 A along x
+    const std::filesystem::path shifted_dir =
+        std::filesystem::temp_directory_path() / "x3dna_test_shifted_templates";
+    std::filesystem::create_directories(shifted_dir);
+    {
+        std::ifstream in("data/templates/Atomic_A.pdb");
+        std::ofstream out(shifted_dir / "Atomic_A.pdb");
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.rfind("ATOM", 0) == 0 && line.size() >= 38) {
+                char x[16];
+                std::snprintf(x, sizeof(x), "%8.3f", std::stod(line.substr(30, 8)) + 5.0);
+                line.replace(30, 8, x);
+            }
+            out << line << '\n';
+        }
+    }
+
+    Residue residue("  A", 1, "A");
+    residue.add_atom(Atom(" C4 ", Vector3D(-1.267, 3.124, 0.000)));
+    residue.add_atom(Atom(" N3 ", Vector3D(-2.320, 2.290, 0.000)));
+    residue.add_atom(Atom(" C2 ", Vector3D(-1.912, 1.023, 0.000)));
+    residue.add_atom(Atom(" N1 ", Vector3D(-0.668, 0.532, 0.000)));
+    residue.add_atom(Atom(" C6 ", Vector3D(0.369, 1.398, 0.000)));
+    residue.add_atom(Atom(" C5 ", Vector3D(0.071, 2.771, 0.000)));
+    residue.add_atom(Atom(" N7 ", Vector3D(0.877, 3.902, 0.000)));
+    residue.add_atom(Atom(" C8 ", Vector3D(0.024, 4.897, 0.000)));
+    residue.add_atom(Atom(" N9 ", Vector3D(-1.291, 4.498, 0.000)));
+
+    BaseFrameCalculator shifted(shifted_dir);
+    const FrameCalculationResult expected = shifted.calculate_frame_const(residue);
+    ASSERT_TRUE(expected.is_valid);
+
+    // Fill the ring template cache from data/templates, then assign
+    const FrameCalculationResult before = calculator_->calculate_frame_const(residue);
+    ASSERT_TRUE(before.is_valid);
+    ASSERT_NE(before.frame.origin(), expected.frame.origin());
+
+    *calculator_ = shifted;
+    const FrameCalculationResult after = calculator_->calculate_frame_const(residue);
+    ASSERT_TRUE(after.is_valid);
+    EXPECT_EQ(after.template_file, expected.template_file);
+    EXPECT_EQ(after.frame.origin(), expected.frame.origin());
+    EXPECT_EQ(after.frame.rotation().as_array(), expected.frame.rotation().as_array());
+
+    std::filesystem::remove_all(shifted_dir);
+}
+
 // Test error handling for invalid residue type
 TEST_F(BaseFrameCalculatorTest, InvalidResidueType) {
     Residue invalid_residue("XXX", 1, "A");
@@ -5,11 +5,16 @@
 
 #include <gtest/gtest.h>
 #include <x3dna/algorithms/base_pair_validator.hpp>
+#include <x3dna/algorithms/validation/overlap_calculator.hpp>
+#include <x3dna/algorithms/validation/ring_data_cache.hpp>
 #include <x3dna/core/residue.hpp>
 #include <x3dna/core/reference_frame.hpp>
 #include <x3dna/core/atom.hpp>
+#include <x3dna/core/thread_pool.hpp>
 #include <x3dna/geometry/vector3d.hpp>
 #include <x3dna/geometry/matrix3d.hpp>
+#include <cmath>
+#include <vector>
 
 using namespace x3dna::algorithms;
 using namespace x3dna::core;
@@ -107,3 +112,183 @@ TEST_F(BasePairValidatorTest, NoFrames) {
     // Should return invalid if no frame
     EXPECT_FALSE(result.is_valid);
 }
+
+namespace {
+
+struct BaseAtom {
+    const char* name;
+    double x, y, z;
+};
+
+// Standard guanine in its base reference frame (legacy Atomic_G.pdb)
+constexpr BaseAtom STANDARD_G[] = {
+    {"C1'", -2.477, 5.399, 0.000}, {"N9", -1.289, 4.551, 0.000}, {"C8", 0.023, 4.962, 0.000},
+    {"N7", 0.870, 3.969, 0.000},   {"C5", 0.071, 2.833, 0.000},  {"C6", 0.424, 1.460, 0.000},
+    {"O6", 1.554, 0.955, 0.000},   {"N1", -0.700, 0.641, 0.000}, {"C2", -1.999, 1.087, 0.000},
+    {"N2", -2.949, 0.139, -0.001}, {"N3", -2.342, 2.364, 0.001}, {"C4", -1.265, 3.177, 0.000},
+};
+
+Residue placed_guanine(int seq, const Matrix3D& rotation, const Vector3D& origin) {
+    std::vector<Atom> atoms;
+    for (const auto& a : STANDARD_G) {
+        atoms.emplace_back(a.name, rotation * Vector3D(a.x, a.y, a.z) + origin);
+    }
+    Residue residue = Residue::create("G", seq, "A")
+                          .classification(x3dna::core::typing::TypeRegistry::instance().classify_residue("G"))
+                          .atoms(atoms)
+                          .build();
+    residue.set_reference_frame(ReferenceFrame(rotation, origin));
+    return residue;
+}
+
+} // namespace
+
+// Short-circuit validation must agree with full validation on every valid pair
+TEST(BasePairValidatorModeTest, ShortCircuitMatchesFullOnValidPairs) {
+    const BasePairValidator validator;
+    const Residue anchor = placed_guanine(1, Matrix3D::identity(), Vector3D(0.0, 0.0, 0.0));
+
+    int num_valid = 0;
+    int num_invalid = 0;
+    for (int step = 0; step < 400; ++step) {
+        // Partner flipped over (antiparallel) or stacked, swept around and away from the anchor
+        const double turn = 0.05 * step;
+        const Matrix3D flip = (step % 2 == 0) ? Matrix3D::rotation_x(M_PI) : Matrix3D::identity();
+        const Matrix3D rotation = Matrix3D::rotation_z(turn) * flip * Matrix3D::rotation_x(0.02 * (step % 7));
+        const Vector3D origin(6.0 + 0.02 * step, -2.0 + 0.01 * step, 0.3 * (step % 5));
+        const Residue partner = placed_guanine(2, rotation, origin);
+
+        const ValidationResult full = validator.validate(anchor, partner, ValidationMode::FULL);
+        const ValidationResult fast = validator.validate(anchor, partner, ValidationMode::SHORT_CIRCUIT);
+
+        ASSERT_EQ(full.is_valid, fast.is_valid) << "step " << step;
+        EXPECT_DOUBLE_EQ(full.dorg, fast.dorg);
+        EXPECT_DOUBLE_EQ(full.quality_score, fast.quality_score);
+        if (!full.is_valid) {
+            num_invalid++;
+            continue;
+        }
+        num_valid++;
+        EXPECT_DOUBLE_EQ(full.dNN, fast.dNN);
+        EXPECT_DOUBLE_EQ(full.overlap_area, fast.overlap_area);
+        EXPECT_EQ(full.num_base_hb, fast.num_base_hb);
+        EXPECT_EQ(full.num_o2_hb, fast.num_o2_hb);
+        ASSERT_EQ(full.hbonds.size(), fast.hbonds.size());
+        for (size_t k = 0; k < full.hbonds.size(); ++k) {
+            EXPECT_EQ(full.hbonds[k].donor_atom, fast.hbonds[k].donor_atom);
+            EXPECT_EQ(full.hbonds[k].acceptor_atom, fast.hbonds[k].acceptor_atom);
+            EXPECT_DOUBLE_EQ(full.hbonds[k].distance, fast.hbonds[k].distance);
+        }
+    }
+
+    EXPECT_GT(num_valid, 0);
+    EXPECT_GT(num_invalid, 0);
+}
+
+// A summary result must score like the full H-bond list, which find_hydrogen_bonds still reproduces
+TEST(BasePairValidatorModeTest, HBondSummaryMatchesList) {
+    const BasePairValidator validator;
+    const Residue anchor = placed_guanine(1, Matrix3D::identity(), Vector3D(0.0, 0.0, 0.0));
+
+    int num_valid = 0;
+    for (int step = 0; step < 400; ++step) {
+        const double turn = 0.05 * step;
+        const Matrix3D flip = (step % 2 == 0) ? Matrix3D::rotation_x(M_PI) : Matrix3D::identity();
+        const Matrix3D rotation = Matrix3D::rotation_z(turn) * flip * Matrix3D::rotation_x(0.02 * (step % 7));
+        const Vector3D origin(6.0 + 0.02 * step, -2.0 + 0.01 * step, 0.3 * (step % 5));
+        const Residue partner = placed_guanine(2, rotation, origin);
+
+        const ValidationResult list = validator.validate(anchor, partner, ValidationMode::SHORT_CIRCUIT);
+        const ValidationResult summary =
+            validator.validate(anchor, partner, ValidationMode::SHORT_CIRCUIT, HBondDetail::SUMMARY);
+
+        ASSERT_EQ(list.is_valid, summary.is_valid) << "step " << step;
+        if (!list.is_valid) {
+            continue;
+        }
+        num_valid++;
+        EXPECT_TRUE(summary.hbonds.empty());
+        EXPECT_EQ(list.num_good_hb, summary.num_good_hb) << "step " << step;
+
+        const auto hbonds = validator.find_hydrogen_bonds(anchor, partner);
+        ASSERT_EQ(hbonds.size(), list.hbonds.size());
+        for (size_t k = 0; k < hbonds.size(); ++k) {
+            EXPECT_EQ(hbonds[k].donor_atom, list.hbonds[k].donor_atom);
+            EXPECT_EQ(hbonds[k].type, list.hbonds[k].type);
+            EXPECT_DOUBLE_EQ(hbonds[k].distance, list.hbonds[k].distance);
+        }
+    }
+
+    EXPECT_GT(num_valid, 0);
+}
+
+// Prepared residues shared by several threads must give the per-call results
+TEST(BasePairValidatorModeTest, PreparedResiduesMatchPerCallValidation) {
+    const BasePairValidator validator;
+    std::vector<Residue> residues;
+    residues.push_back(placed_guanine(1, Matrix3D::identity(), Vector3D(0.0, 0.0, 0.0)));
+    for (int step = 0; step < 200; ++step) {
+        const double turn = 0.1 * step;
+        const Matrix3D flip = (step % 2 == 0) ? Matrix3D::rotation_x(M_PI) : Matrix3D::identity();
+        const Matrix3D rotation = Matrix3D::rotation_z(turn) * flip * Matrix3D::rotation_x(0.02 * (step % 7));
+        const Vector3D origin(6.0 + 0.04 * step, -2.0 + 0.02 * step, 0.3 * (step % 5));
+        residues.push_back(placed_guanine(step + 2, rotation, origin));
+    }
+
+    std::vector<const Residue*> pointers;
+    for (const auto& residue : residues) {
+        pointers.push_back(&residue);
+    }
+    const PreparedResidues prepared = validator.prepare(pointers);
+    ASSERT_EQ(prepared.size(), residues.size());
+
+    std::vector<ValidationResult> shared(residues.size());
+    x3dna::core::ThreadPool pool(4);
+    pool.parallel_for(residues.size() - 1, [&](size_t task, size_t /* worker */) {
+        shared[task + 1] = validator.validate(prepared[0], prepared[task + 1]);
+    });
+
+    int num_valid = 0;
+    for (size_t k = 1; k < residues.size(); ++k) {
+        const ValidationResult expected = validator.validate(residues[0], residues[k]);
+        const ValidationResult& actual = shared[k];
+        ASSERT_EQ(expected.is_valid, actual.is_valid) << "partner " << k;
+        EXPECT_DOUBLE_EQ(expected.overlap_area, actual.overlap_area) << "partner " << k;
+        EXPECT_EQ(expected.num_base_hb, actual.num_base_hb) << "partner " << k;
+        EXPECT_EQ(expected.num_o2_hb, actual.num_o2_hb) << "partner " << k;
+        EXPECT_EQ(expected.hbonds.size(), actual.hbonds.size()) << "partner " << k;
+        num_valid += expected.is_valid;
+    }
+    EXPECT_GT(num_valid, 0);
+}
+
+// Cached ring polygons with the early exits must give the full overlap area, including near-touching pairs
+TEST(BasePairValidatorModeTest, CachedOverlapMatchesFullCalculation) {
+    using x3dna::algorithms::validation::OverlapCalculator;
+    using x3dna::algorithms::validation::ResidueRingData;
+
+    const Residue anchor = placed_guanine(1, Matrix3D::identity(), Vector3D(0.0, 0.0, 0.0));
+    const ResidueRingData anchor_ring = ResidueRingData::compute(anchor);
+
+    int num_overlapping = 0;
+    int num_disjoint = 0;
+    for (int step = 0; step < 600; ++step) {
+        // Stacked partner slid sideways from full overlap to well clear, tilted and turned
+        const double turn = 0.07 * step;
+        const Matrix3D rotation = Matrix3D::rotation_z(turn) * Matrix3D::rotation_x(0.03 * (step % 9));
+        const double slide = 0.025 * step;
+        const Vector3D origin(slide * std::cos(0.3 * step), slide * std::sin(0.3 * step), 3.4);
+        const Residue partner = placed_guanine(2, rotation, origin);
+
+        const Vector3D oave = (Vector3D(0.0, 0.0, 0.0) + origin) * 0.5;
+        const Vector3D zave = (Vector3D(0.0, 0.0, 1.0) + rotation.column(2)).normalized();
+
+        const double expected = OverlapCalculator::calculate(anchor, partner, oave, zave);
+        const double actual =
+            OverlapCalculator::calculate(anchor_ring, ResidueRingData::compute(partner), oave, zave);
+        ASSERT_EQ(expected, actual) << "step " << step;
+        (expected > 0.0 ? num_overlapping : num_disjoint)++;
+    }
+    EXPECT_GT(num_overlapping, 0);
+    EXPECT_GT(num_disjoint, 0);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file test_candidate_table.cpp
+ * @brief Unit tests for CandidateTable
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/algorithms/pair_identification/candidate_table.hpp>
+#include <limits>
+
+using namespace x3dna::algorithms;
+
+namespace {
+
+CandidateInfo make_info(bool valid, int bp_type_id, double quality) {
+    ValidationResult result;
+    result.is_valid = valid;
+    result.quality_score = quality;
+    return CandidateInfo{result, bp_type_id, quality};
+}
+
+} // namespace
+
+class CandidateTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        table_.reset(6);
+        table_.add(1, 3, make_info(true, 2, -5.0), -5.0);
+        table_.add(1, 5, make_info(false, 0, 9.0), std::numeric_limits<double>::max());
+        table_.add(2, 3, make_info(true, -1, 1.5), 1.5);
+        table_.add(3, 6, make_info(true, 1, 0.5), 0.5);
+        table_.finalize();
+    }
+
+    CandidateTable table_;
+};
+
+TEST_F(CandidateTableTest, RowsAreSortedAndSymmetric) {
+    auto row3 = table_.row(3);
+    ASSERT_EQ(row3.size(), 3u);
+    EXPECT_EQ(row3.begin()[0].partner, 1);
+    EXPECT_EQ(row3.begin()[1].partner, 2);
+    EXPECT_EQ(row3.begin()[2].partner, 6);
+
+    auto row1 = table_.row(1);
+    ASSERT_EQ(row1.size(), 2u);
+    EXPECT_EQ(row1.begin()[0].partner, 3);
+    EXPECT_EQ(row1.begin()[1].partner, 5);
+
+    EXPECT_TRUE(table_.row(4).empty());
+}
+
+TEST_F(CandidateTableTest, FindIsOrderIndependent) {
+    const CandidateInfo* a = table_.find(2, 3);
+    const CandidateInfo* b = table_.find(3, 2);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a->bp_type_id, -1);
+    EXPECT_EQ(table_.find(1, 2), nullptr);
+    EXPECT_EQ(table_.find(0, 99), nullptr);
+}
+
+TEST_F(CandidateTableTest, EntriesCarryScoreAndValidity) {
+    const CandidateEntry* entry = table_.find_entry(5, 1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(entry->is_valid);
+    EXPECT_EQ(entry->score, std::numeric_limits<double>::max());
+
+    entry = table_.find_entry(6, 3);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_TRUE(entry->is_valid);
+    EXPECT_EQ(entry->bp_type_id, 1);
+    EXPECT_DOUBLE_EQ(entry->score, 0.5);
+    EXPECT_DOUBLE_EQ(table_.info(*entry).adjusted_quality_score, 0.5);
+}
+
+TEST_F(CandidateTableTest, PairsKeepInsertionOrder) {
+    ASSERT_EQ(table_.size(), 4u);
+    EXPECT_EQ(table_.pairs()[0].first, std::make_pair(1, 3));
+    EXPECT_EQ(table_.pairs()[3].first, std::make_pair(3, 6));
+}
+
+TEST_F(CandidateTableTest, UnsortedInsertion) {
+    CandidateTable table;
+    table.reset(4);
+    table.add(2, 4, make_info(true, -1, 1.0), 1.0);
+    table.add(1, 4, make_info(true, -1, 2.0), 2.0);
+    table.add(3, 4, make_info(true, -1, 3.0), 3.0);
+    table.finalize();
+
+    auto row = table.row(4);
+    ASSERT_EQ(row.size(), 3u);
+    EXPECT_EQ(row.begin()[0].partner, 1);
+    EXPECT_EQ(row.begin()[1].partner, 2);
+    EXPECT_EQ(row.begin()[2].partner, 3);
+    EXPECT_DOUBLE_EQ(table.info(row.begin()[0]).adjusted_quality_score, 2.0);
+}
+
+TEST_F(CandidateTableTest, ResetClears) {
+    table_.reset(0);
+    EXPECT_TRUE(table_.empty());
+    EXPECT_TRUE(table_.row(1).empty());
+    EXPECT_EQ(table_.find(1, 3), nullptr);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_frame_table.cpp
+ * @brief Unit tests for FrameTable (batch prefilter against per-pair frame geometry)
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/algorithms/pair_identification/frame_table.hpp>
+#include <x3dna/core/reference_frame.hpp>
+#include <x3dna/geometry/matrix3d.hpp>
+#include <cmath>
+#include <random>
+
+using namespace x3dna::algorithms;
+using namespace x3dna::core;
+using namespace x3dna::geometry;
+
+namespace {
+
+// Per-pair reference: the same formulas BasePairValidator::validate uses
+struct ReferenceGeometry {
+    double dorg, d_v, plane_angle, dir_x, dir_y, dir_z;
+};
+
+ReferenceGeometry reference_geometry(const ReferenceFrame& f1, const ReferenceFrame& f2) {
+    ReferenceGeometry g{};
+    const Vector3D dorg = f1.origin() - f2.origin();
+    const Vector3D z1 = f1.z_axis();
+    const Vector3D z2 = f2.z_axis();
+    Vector3D zave = z1.dot(z2) > 0.0 ? z2 + z1 : z2 - z1;
+    zave = zave.length() > 1e-10 ? zave / zave.length() : z1;
+
+    g.dorg = dorg.length();
+    g.d_v = std::abs(dorg.dot(zave));
+    const double angle = std::acos(std::max(-1.0, std::min(1.0, z1.dot(z2)))) * 180.0 / M_PI;
+    g.plane_angle = angle > 90.0 ? 180.0 - angle : angle;
+    g.dir_x = f1.x_axis().dot(f2.x_axis());
+    g.dir_y = f1.y_axis().dot(f2.y_axis());
+    g.dir_z = z1.dot(z2);
+    return g;
+}
+
+ReferenceFrame random_frame(std::mt19937& rng, double box) {
+    std::uniform_real_distribution<double> coord(-box, box);
+    std::normal_distribution<double> gauss(0.0, 1.0);
+    const Vector3D x = Vector3D(gauss(rng), gauss(rng), gauss(rng)).normalized();
+    const Vector3D b(gauss(rng), gauss(rng), gauss(rng));
+    const Vector3D y = (b - x * b.dot(x)).normalized();
+    const Vector3D z = x.cross(y);
+    const Matrix3D rotation(x.x(), y.x(), z.x(), x.y(), y.y(), z.y(), x.z(), y.z(), z.z());
+    return ReferenceFrame(rotation, Vector3D(coord(rng), coord(rng), coord(rng) * 0.2));
+}
+
+} // namespace
+
+TEST(FrameTableTest, PrefilterMatchesPerPairGeometry) {
+    std::mt19937 rng(7);
+    std::vector<Residue> residues(150);
+    std::vector<const Residue*> pointers;
+    for (size_t i = 0; i < residues.size(); ++i) {
+        residues[i] = Residue("A", static_cast<int>(i) + 1, "A");
+        residues[i].set_reference_frame(random_frame(rng, 12.0));
+        pointers.push_back(&residues[i]);
+    }
+
+    FrameTable frames;
+    frames.build(pointers);
+    ASSERT_EQ(frames.size(), residues.size());
+
+    const ValidationParameters params;
+    size_t counts[3] = {0, 0, 0};
+    for (size_t i = 0; i < residues.size(); ++i) {
+        // More partners than one kernel block, to cover the block loop
+        std::vector<size_t> others;
+        for (size_t j = 0; j < residues.size(); ++j) {
+            if (j != i) {
+                others.push_back(j);
+            }
+        }
+        std::vector<FrameTable::PairGeometry> out(others.size());
+        frames.prefilter(i, others.data(), others.size(), params, out.data());
+
+        for (size_t k = 0; k < others.size(); ++k) {
+            const auto ref = reference_geometry(*residues[i].reference_frame(), *residues[others[k]].reference_frame());
+            const auto& g = out[k];
+            EXPECT_NEAR(g.dorg, ref.dorg, 1e-9);
+            EXPECT_NEAR(g.d_v, ref.d_v, 1e-9);
+            EXPECT_NEAR(g.dir_x, ref.dir_x, 1e-12);
+            EXPECT_NEAR(g.dir_y, ref.dir_y, 1e-12);
+            EXPECT_NEAR(g.dir_z, ref.dir_z, 1e-12);
+
+            const bool in_range = ref.dorg <= params.max_dorg;
+            const bool frame_checks_pass = ref.dorg >= params.min_dorg && ref.d_v >= params.min_dv &&
+                                           ref.d_v <= params.max_dv && ref.plane_angle >= params.min_plane_angle &&
+                                           ref.plane_angle <= params.max_plane_angle;
+            if (!in_range) {
+                EXPECT_EQ(g.screen, FrameTable::Screen::OUT_OF_RANGE);
+            } else if (frame_checks_pass) {
+                // Never reject a pair full validation could accept
+                EXPECT_EQ(g.screen, FrameTable::Screen::CANDIDATE);
+            } else {
+                EXPECT_EQ(g.screen, FrameTable::Screen::REJECTED);
+            }
+            counts[static_cast<size_t>(g.screen)]++;
+
+            if (g.screen == FrameTable::Screen::REJECTED) {
+                const ValidationResult result = FrameTable::rejected_result(g, params);
+                EXPECT_FALSE(result.is_valid);
+                EXPECT_NEAR(result.plane_angle, ref.plane_angle, 1e-9);
+                EXPECT_FALSE(result.distance_check && result.d_v_check && result.plane_angle_check);
+            }
+        }
+    }
+
+    // The random layout exercises every outcome
+    EXPECT_GT(counts[0], 0u);
+    EXPECT_GT(counts[1], 0u);
+    EXPECT_GT(counts[2], 0u);
+}
+
+TEST(FrameTableTest, BuildRequiresFrames) {
+    Residue residue("A", 1, "A");
+    FrameTable frames;
+    EXPECT_THROW(frames.build({&residue}), std::invalid_argument);
+}
@@ -0,0 +1,289 @@
+/**
+ * @file test_hbond_detector.cpp
+ * @brief Unit tests for HBondDetector atom indexing and potential H-bond counting
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/algorithms/hydrogen_bond/angle_reference_table.hpp>
+#include <x3dna/algorithms/hydrogen_bond/detector.hpp>
+#include <x3dna/algorithms/hydrogen_bond/geometry.hpp>
+#include <x3dna/algorithms/hydrogen_bond/hydrogen_bond_utils.hpp>
+#include <x3dna/core/chain.hpp>
+#include <x3dna/core/residue.hpp>
+#include <x3dna/core/structure.hpp>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace x3dna::algorithms;
+using namespace x3dna::algorithms::hydrogen_bond;
+using namespace x3dna::core;
+using namespace x3dna::geometry;
+using x3dna::core::typing::TypeRegistry;
+
+namespace {
+
+// Mix of base, sugar, backbone and non-polar atoms, including PO-list and O2' atoms
+const std::vector<std::string> ATOM_NAMES = {"N1", "C2", "O2",  "N3",  "C4",  "O4",  "N4",  "C5",  "C5M", "N6",
+                                             "O6", "N7", "N9",  "P",   "OP1", "OP2", "O5'", "C5'", "O4'", "O3'",
+                                             "O2'", "C1'", "C2'", "H21", "S1"};
+
+Residue random_residue(std::mt19937& rng, const std::string& name, int seq, const Vector3D& center) {
+    std::uniform_int_distribution<size_t> pick(0, ATOM_NAMES.size() - 1);
+    std::uniform_real_distribution<double> offset(-3.0, 3.0);
+
+    std::vector<Atom> atoms;
+    for (int i = 0; i < 20; ++i) {
+        atoms.emplace_back(ATOM_NAMES[pick(rng)], center + Vector3D(offset(rng), offset(rng), offset(rng)));
+    }
+    return Residue::create(name, seq, "A")
+        .classification(TypeRegistry::instance().classify_residue(name))
+        .atoms(atoms)
+        .build();
+}
+
+// Direct all-atoms scan (original count_potential_hbonds)
+void reference_counts(const Residue& res1, const Residue& res2, const HBondDetectionParams& params, int& num_base_hb,
+                      int& num_o2_hb) {
+    num_base_hb = 0;
+    num_o2_hb = 0;
+    for (const auto& a1 : res1.atoms()) {
+        for (const auto& a2 : res2.atoms()) {
+            const double dist = (a1.position() - a2.position()).length();
+            if (dist < params.distances.min_distance || dist > params.distances.base_base_max) {
+                continue;
+            }
+            const bool not_o2prime = !a1.is_o2_prime() && !a2.is_o2_prime();
+            if (is_base_atom(a1.name()) && is_base_atom(a2.name()) && not_o2prime &&
+                good_hb_atoms(a1.name(), a2.name(), params.allowed_elements)) {
+                num_base_hb++;
+            }
+            if (a1.is_o2_prime() || a2.is_o2_prime()) {
+                num_o2_hb++;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(HBondDetectorTest, IndexKeepsAllowedElementsInAtomOrder) {
+    std::mt19937 rng(7);
+    const HBondDetector detector(HBondDetectionParams::legacy_compatible());
+    const Residue residue = random_residue(rng, "G", 1, Vector3D(0, 0, 0));
+
+    const HBondAtomIndex index = detector.index_atoms(residue);
+    EXPECT_EQ(index.num_atoms, residue.num_atoms());
+
+    size_t previous = 0;
+    for (const auto& polar : index.polar_atoms) {
+        EXPECT_GE(polar.atom_idx, previous);
+        previous = polar.atom_idx;
+
+        const auto& atom = residue.atoms()[polar.atom_idx];
+        EXPECT_TRUE(polar.is_o_or_n) << atom.name();
+        EXPECT_EQ(polar.legacy_base, is_base_atom(atom.name()));
+        EXPECT_EQ(polar.o2_prime, atom.is_o2_prime());
+        EXPECT_EQ(polar.po_list, is_po_list_atom(atom.name()));
+    }
+    for (size_t i : index.o2_prime_atoms) {
+        EXPECT_TRUE(residue.atoms()[i].is_o2_prime());
+    }
+}
+
+TEST(HBondDetectorTest, IndexedCountsMatchFullAtomScan) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> shift(0.0, 6.0);
+    const auto params = HBondDetectionParams::legacy_compatible();
+    const HBondDetector detector(params);
+
+    int pairs_with_base_hb = 0;
+    int pairs_with_o2_hb = 0;
+    for (int trial = 0; trial < 200; ++trial) {
+        const Residue res1 = random_residue(rng, "G", 1, Vector3D(0, 0, 0));
+        const Residue res2 = random_residue(rng, "C", 2, Vector3D(shift(rng), shift(rng), 0.0));
+
+        int expected_base = 0;
+        int expected_o2 = 0;
+        reference_counts(res1, res2, params, expected_base, expected_o2);
+
+        int num_base_hb = -1;
+        int num_o2_hb = -1;
+        detector.count_potential_hbonds(res1, detector.index_atoms(res1), res2, detector.index_atoms(res2),
+                                        num_base_hb, num_o2_hb);
+        EXPECT_EQ(num_base_hb, expected_base) << "trial " << trial;
+        EXPECT_EQ(num_o2_hb, expected_o2) << "trial " << trial;
+
+        pairs_with_base_hb += expected_base > 0;
+        pairs_with_o2_hb += expected_o2 > 0;
+    }
+
+    // The random layouts must exercise both counters
+    EXPECT_GT(pairs_with_base_hb, 0);
+    EXPECT_GT(pairs_with_o2_hb, 0);
+}
+
+// The cell-list search must find the same bonds as checking every residue pair within the center cutoff
+TEST(HBondDetectorTest, StructureHBondsMatchAllResiduePairs) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> place(0.0, 24.0);
+    const HBondDetector detector(HBondDetectionParams::dssr_like());
+    const double max_residue_distance = 15.0;
+
+    // Sequence numbers two apart, so no pair takes the phosphodiester filter
+    Structure structure("TEST");
+    Chain chain("A");
+    for (int i = 0; i < 40; ++i) {
+        chain.add_residue(random_residue(rng, i % 2 == 0 ? "G" : "C", 2 * i + 1,
+                                         Vector3D(place(rng), place(rng), place(rng))));
+    }
+    structure.add_chain(chain);
+
+    const auto result = detector.detect_all_structure_hbonds(structure, max_residue_distance);
+
+    const auto residues = structure.all_residues();
+    std::vector<Vector3D> centers;
+    for (const auto* residue : residues) {
+        Vector3D sum(0.0, 0.0, 0.0);
+        size_t count = 0;
+        for (const auto& atom : residue->atoms()) {
+            if (atom.name()[0] != 'H') {
+                sum = sum + atom.position();
+                ++count;
+            }
+        }
+        centers.push_back(sum * (1.0 / count));
+    }
+
+    std::vector<ResidueHBonds> expected;
+    for (size_t i = 0; i < residues.size(); ++i) {
+        for (size_t j = i + 1; j < residues.size(); ++j) {
+            if ((centers[i] - centers[j]).length() > max_residue_distance) {
+                continue;
+            }
+            auto hbonds = detector.detect_all_hbonds_between(*residues[i], *residues[j]);
+            if (!hbonds.empty()) {
+                expected.push_back({residues[i]->res_id(), residues[j]->res_id(), i, j, std::move(hbonds)});
+            }
+        }
+    }
+
+    ASSERT_EQ(result.residue_pair_hbonds.size(), expected.size());
+    EXPECT_GT(expected.size(), 0u);
+    for (size_t k = 0; k < expected.size(); ++k) {
+        const auto& actual = result.residue_pair_hbonds[k];
+        EXPECT_EQ(actual.residue_idx_i, expected[k].residue_idx_i);
+        EXPECT_EQ(actual.residue_idx_j, expected[k].residue_idx_j);
+        ASSERT_EQ(actual.hbonds.size(), expected[k].hbonds.size()) << "pair " << k;
+        for (size_t b = 0; b < actual.hbonds.size(); ++b) {
+            EXPECT_EQ(actual.hbonds[b].donor_atom_name, expected[k].hbonds[b].donor_atom_name);
+            EXPECT_EQ(actual.hbonds[b].acceptor_atom_name, expected[k].hbonds[b].acceptor_atom_name);
+            EXPECT_EQ(actual.hbonds[b].distance, expected[k].hbonds[b].distance);
+            EXPECT_EQ(actual.hbonds[b].classification, expected[k].hbonds[b].classification);
+            // Angles from the per-residue tables match the per-bond name lookups
+            EXPECT_EQ(actual.hbonds[b].donor_angle, expected[k].hbonds[b].donor_angle);
+            EXPECT_EQ(actual.hbonds[b].acceptor_angle, expected[k].hbonds[b].acceptor_angle);
+            EXPECT_EQ(actual.hbonds[b].dihedral_angle, expected[k].hbonds[b].dihedral_angle);
+        }
+    }
+}
+
+// Blocks of residue pairs run on several threads must merge into the serial result
+TEST(HBondDetectorTest, StructureHBondsParallelMatchesSerial) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> place(0.0, 40.0);
+
+    // Enough polar atoms and residue pairs for several parallel tasks
+    Structure structure("TEST");
+    Chain chain("A");
+    for (int i = 0; i < 300; ++i) {
+        chain.add_residue(random_residue(rng, i % 2 == 0 ? "A" : "U", i + 1,
+                                         Vector3D(place(rng), place(rng), place(rng))));
+    }
+    structure.add_chain(chain);
+
+    HBondDetector detector(HBondDetectionParams::dssr_like());
+    const auto serial = detector.detect_all_structure_hbonds(structure);
+    detector.set_num_threads(4);
+    const auto parallel = detector.detect_all_structure_hbonds(structure);
+
+    EXPECT_EQ(serial.total_residue_pairs_checked, parallel.total_residue_pairs_checked);
+    EXPECT_EQ(serial.pairs_with_hbonds, parallel.pairs_with_hbonds);
+    ASSERT_EQ(serial.residue_pair_hbonds.size(), parallel.residue_pair_hbonds.size());
+    for (size_t k = 0; k < serial.residue_pair_hbonds.size(); ++k) {
+        EXPECT_EQ(serial.residue_pair_hbonds[k].residue_idx_i, parallel.residue_pair_hbonds[k].residue_idx_i);
+        EXPECT_EQ(serial.residue_pair_hbonds[k].residue_idx_j, parallel.residue_pair_hbonds[k].residue_idx_j);
+    }
+    ASSERT_EQ(serial.all_hbonds.size(), parallel.all_hbonds.size());
+    EXPECT_GT(serial.all_hbonds.size(), 0u);
+    for (size_t k = 0; k < serial.all_hbonds.size(); ++k) {
+        EXPECT_EQ(serial.all_hbonds[k].donor_residue_idx, parallel.all_hbonds[k].donor_residue_idx);
+        EXPECT_EQ(serial.all_hbonds[k].donor_atom_name, parallel.all_hbonds[k].donor_atom_name);
+        EXPECT_EQ(serial.all_hbonds[k].acceptor_atom_name, parallel.all_hbonds[k].acceptor_atom_name);
+        EXPECT_EQ(serial.all_hbonds[k].distance, parallel.all_hbonds[k].distance);
+    }
+}
+
+// The occupancy filter counts bonds per (residue, atom) and regroups the survivors by residue ID
+TEST(HBondDetectorTest, GlobalOccupancyFilterLimitsBondsPerAtom) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> place(0.0, 20.0);
+    Structure structure("TEST");
+    Chain chain("A");
+    for (int i = 0; i < 40; ++i) {
+        chain.add_residue(random_residue(rng, "G", 2 * i + 1, Vector3D(place(rng), place(rng), place(rng))));
+    }
+    structure.add_chain(chain);
+
+    const HBondDetector detector(HBondDetectionParams::dssr_like());
+    auto result = detector.detect_all_structure_hbonds(structure);
+    const size_t num_detected = result.all_hbonds.size();
+    detector.apply_global_occupancy_filter(result, 1, 2);
+    EXPECT_LT(result.all_hbonds.size(), num_detected);
+
+    std::map<std::pair<size_t, size_t>, int> occupancy;
+    for (const auto& hb : result.all_hbonds) {
+        ++occupancy[std::make_pair(hb.donor_residue_idx, hb.donor_atom_idx)];
+        ++occupancy[std::make_pair(hb.acceptor_residue_idx, hb.acceptor_atom_idx)];
+    }
+    for (const auto& [atom, count] : occupancy) {
+        EXPECT_LE(count, 2) << "residue " << atom.first << " atom " << atom.second;
+    }
+
+    size_t num_grouped = 0;
+    for (size_t k = 0; k < result.residue_pair_hbonds.size(); ++k) {
+        const auto& pair = result.residue_pair_hbonds[k];
+        EXPECT_LE(pair.res_id_i, pair.res_id_j);
+        if (k > 0) {
+            const auto& previous = result.residue_pair_hbonds[k - 1];
+            EXPECT_LT(std::tie(previous.res_id_i, previous.res_id_j), std::tie(pair.res_id_i, pair.res_id_j));
+        }
+        num_grouped += pair.hbonds.size();
+    }
+    EXPECT_EQ(num_grouped, result.all_hbonds.size());
+    EXPECT_EQ(result.pairs_with_hbonds, result.residue_pair_hbonds.size());
+}
+
+TEST(HBondDetectorTest, AngleReferencesMatchNamedLookup) {
+    std::mt19937 rng(5);
+    const Residue residue = random_residue(rng, "C", 1, Vector3D(0.0, 0.0, 0.0));
+    const auto& atoms = residue.atoms();
+    const AngleReferenceTable table(residue);
+    ASSERT_EQ(table.size(), atoms.size());
+
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        // Same atom Residue::find_atom returns for the reference name
+        std::optional<size_t> expected;
+        const std::string reference_name = HBondGeometry::get_neighbor_atom_name(atoms[i].name());
+        for (size_t k = 0; k < atoms.size() && !reference_name.empty(); ++k) {
+            if (atoms[k].name() == reference_name) {
+                expected = k;
+                break;
+            }
+        }
+        EXPECT_EQ(table.angle_reference(i), expected) << atoms[i].name();
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file test_mutual_best_matcher.cpp
+ * @brief Unit tests for MutualBestMatcher (equivalence with the legacy pass loop)
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/algorithms/pair_identification/mutual_best_matcher.hpp>
+#include <limits>
+#include <random>
+
+using namespace x3dna::algorithms;
+
+namespace {
+
+// Straight transcription of legacy find_bestpair selection over a candidate table
+std::vector<std::pair<int, int>> legacy_selection(const CandidateTable& table) {
+    const int n = table.max_legacy_idx();
+    std::vector<bool> matched(static_cast<size_t>(n) + 1, false);
+    std::vector<std::pair<int, int>> selected;
+
+    auto best_partner = [&](int idx) {
+        double best_score = std::numeric_limits<double>::max();
+        int best = 0;
+        for (const auto& entry : table.row(idx)) {
+            if (entry.is_valid && !matched[entry.partner] && entry.score < best_score) {
+                best_score = entry.score;
+                best = entry.partner;
+            }
+        }
+        return best;
+    };
+
+    size_t prev = 0;
+    do {
+        prev = selected.size();
+        for (int i = 1; i <= n; ++i) {
+            if (matched[i]) {
+                continue;
+            }
+            int j = best_partner(i);
+            if (j != 0 && best_partner(j) == i) {
+                matched[i] = matched[j] = true;
+                selected.emplace_back(i, j);
+            }
+        }
+    } while (selected.size() > prev);
+    return selected;
+}
+
+CandidateTable random_table(int n, double density, unsigned seed, bool coarse_scores) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    CandidateTable table;
+    table.reset(n);
+    for (int i = 1; i < n; ++i) {
+        for (int j = i + 1; j <= n; ++j) {
+            if (unit(rng) > density) {
+                continue;
+            }
+            const bool valid = unit(rng) < 0.7;
+            // Coarse scores produce many ties to exercise the index tie-break
+            double score = coarse_scores ? static_cast<double>(static_cast<int>(unit(rng) * 4)) : unit(rng) * 20.0 - 10.0;
+            ValidationResult result;
+            result.is_valid = valid;
+            table.add(i, j, CandidateInfo{result, valid ? -1 : 0, score},
+                      valid ? score : std::numeric_limits<double>::max());
+        }
+    }
+    table.finalize();
+    return table;
+}
+
+void expect_matches_legacy(const CandidateTable& table) {
+    auto expected = legacy_selection(table);
+    MutualBestMatcher matcher(table);
+    auto actual = matcher.run();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t k = 0; k < expected.size(); ++k) {
+        EXPECT_EQ(actual[k].legacy_idx1, expected[k].first) << "pair " << k;
+        EXPECT_EQ(actual[k].legacy_idx2, expected[k].second) << "pair " << k;
+    }
+}
+
+} // namespace
+
+TEST(MutualBestMatcherTest, EmptyTable) {
+    CandidateTable table;
+    table.reset(0);
+    table.finalize();
+    MutualBestMatcher matcher(table);
+    EXPECT_TRUE(matcher.run().empty());
+    EXPECT_EQ(matcher.num_passes(), 1);
+}
+
+TEST(MutualBestMatcherTest, SimpleChainNeedsTwoPasses) {
+    // 1-2 best mutual; 3 prefers 2 but settles for 4 once 2 is taken
+    CandidateTable table;
+    table.reset(4);
+    ValidationResult valid;
+    valid.is_valid = true;
+    table.add(1, 2, CandidateInfo{valid, -1, 1.0}, 1.0);
+    table.add(2, 3, CandidateInfo{valid, -1, 2.0}, 2.0);
+    table.add(3, 4, CandidateInfo{valid, -1, 5.0}, 5.0);
+    table.finalize();
+
+    MutualBestMatcher matcher(table);
+    auto matches = matcher.run();
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0].legacy_idx1, 1);
+    EXPECT_EQ(matches[0].legacy_idx2, 2);
+    EXPECT_EQ(matches[1].legacy_idx1, 3);
+    EXPECT_EQ(matches[1].legacy_idx2, 4);
+    expect_matches_legacy(table);
+}
+
+TEST(MutualBestMatcherTest, LaterVisitSelectsPairWithinPass) {
+    // Pair (2,5) only becomes mutual after 3-4 is selected; 5 is visited later in the same
+    // pass, so legacy records the pair from residue 5's visit
+    CandidateTable table;
+    table.reset(5);
+    ValidationResult valid;
+    valid.is_valid = true;
+    table.add(2, 4, CandidateInfo{valid, -1, 1.0}, 1.0);
+    table.add(2, 5, CandidateInfo{valid, -1, 3.0}, 3.0);
+    table.add(3, 4, CandidateInfo{valid, -1, 0.5}, 0.5);
+    table.finalize();
+    expect_matches_legacy(table);
+}
+
+TEST(MutualBestMatcherTest, RandomTablesMatchLegacy) {
+    for (unsigned seed = 0; seed < 40; ++seed) {
+        expect_matches_legacy(random_table(60, 0.15, seed, false));
+    }
+}
+
+TEST(MutualBestMatcherTest, RandomTablesWithTiesMatchLegacy) {
+    for (unsigned seed = 100; seed < 140; ++seed) {
+        expect_matches_legacy(random_table(50, 0.25, seed, true));
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_nucleotide_eligibility.cpp
+ * @brief Unit tests for NucleotideEligibility
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/algorithms/pair_identification/nucleotide_eligibility.hpp>
+#include <x3dna/algorithms/base_pair_finder.hpp>
+#include <x3dna/core/chain.hpp>
+#include <x3dna/core/structure.hpp>
+#include <string>
+#include <vector>
+
+using namespace x3dna::algorithms;
+using namespace x3dna::core;
+using namespace x3dna::geometry;
+using x3dna::core::typing::MoleculeType;
+using x3dna::core::typing::ResidueClassification;
+using x3dna::core::typing::TypeRegistry;
+
+namespace {
+
+struct RingAtom {
+    const char* name;
+    double x, y, z;
+};
+
+// Standard base ring (legacy xyz_ring)
+constexpr RingAtom STANDARD_RING[] = {
+    {"C4", -1.265, 3.177, 0.000}, {"N3", -2.342, 2.364, 0.001}, {"C2", -1.999, 1.087, 0.000},
+    {"N1", -0.700, 0.641, 0.000}, {"C6", 0.424, 1.460, 0.000},  {"C5", 0.071, 2.833, 0.000},
+    {"N7", 0.870, 3.969, 0.000},  {"C8", 0.023, 4.962, 0.000},  {"N9", -1.289, 4.551, 0.000},
+};
+
+// Nucleic acid of unknown base type: the case that needs the ring RMSD fit
+ResidueClassification unknown_base() {
+    ResidueClassification classification;
+    classification.molecule_type = MoleculeType::NUCLEIC_ACID;
+    return classification;
+}
+
+Residue make_residue(const std::string& name, int legacy_idx, const ResidueClassification& classification,
+                     const std::vector<Atom>& atoms) {
+    return Residue::create(name, legacy_idx, "A")
+        .classification(classification)
+        .atoms(atoms)
+        .legacy_residue_idx(legacy_idx)
+        .build();
+}
+
+template <typename Transform> std::vector<Atom> standard_ring_atoms(Transform transform) {
+    std::vector<Atom> atoms;
+    for (const auto& a : STANDARD_RING) {
+        atoms.emplace_back(a.name, transform(Vector3D(a.x, a.y, a.z)));
+    }
+    return atoms;
+}
+
+// Residue 1: guanine; 2: unknown base with an ideal purine ring; 3: unknown base with a
+// distorted ring; 4: unclassified residue without ring atoms
+Structure make_structure() {
+    Chain chain("A");
+    chain.add_residue(make_residue("G", 1, TypeRegistry::instance().classify_residue("G"),
+                                   standard_ring_atoms([](const Vector3D& p) { return p + Vector3D(0, 0, 10); })));
+    chain.add_residue(make_residue("XYZ", 2, unknown_base(),
+                                   standard_ring_atoms([](const Vector3D& p) { return p + Vector3D(20, 0, 0); })));
+    chain.add_residue(make_residue("XYZ", 3, unknown_base(), standard_ring_atoms([](const Vector3D& p) {
+                                       return Vector3D(3.0 * p.x(), p.y() - 40.0, p.x() * p.y());
+                                   })));
+    chain.add_residue(make_residue("LIG", 4, ResidueClassification{},
+                                   {Atom("C1", Vector3D(50.0, 0.0, 0.0)), Atom("O1", Vector3D(51.2, 0.0, 0.0))}));
+
+    Structure structure("TEST");
+    structure.add_chain(chain);
+    return structure;
+}
+
+} // namespace
+
+TEST(NucleotideEligibilityTest, MatchesPerResidueClassification) {
+    Structure structure = make_structure();
+    NucleotideEligibility eligibility;
+    eligibility.build(structure);
+
+    ASSERT_EQ(eligibility.max_legacy_idx(), 4);
+    for (const auto& chain : structure.chains()) {
+        for (const auto& residue : chain.residues()) {
+            const int idx = residue.legacy_residue_idx();
+            EXPECT_EQ(eligibility.is_nucleotide(idx), BasePairFinder::is_nucleotide(residue)) << "residue " << idx;
+        }
+    }
+
+    EXPECT_TRUE(eligibility.is_nucleotide(1));
+    EXPECT_TRUE(eligibility.is_nucleotide(2));
+    EXPECT_FALSE(eligibility.is_nucleotide(3));
+    EXPECT_FALSE(eligibility.is_nucleotide(4));
+
+    // RMSD is only computed for residues that need the fit
+    EXPECT_FALSE(eligibility.rmsd(1).has_value());
+    ASSERT_TRUE(eligibility.rmsd(2).has_value());
+    EXPECT_LT(*eligibility.rmsd(2), 1e-3);
+    ASSERT_TRUE(eligibility.rmsd(3).has_value());
+    EXPECT_GT(*eligibility.rmsd(3), 0.2618);
+
+    // Out-of-range indices are never eligible
+    EXPECT_FALSE(eligibility.is_nucleotide(0));
+    EXPECT_FALSE(eligibility.is_nucleotide(5));
+    EXPECT_FALSE(eligibility.rmsd(-1).has_value());
+}
+
+TEST(NucleotideEligibilityTest, ThreadCountDoesNotChangeResult) {
+    Structure structure = make_structure();
+    NucleotideEligibility serial;
+    serial.build(structure, 1);
+    NucleotideEligibility parallel;
+    parallel.build(structure, 4);
+
+    ASSERT_EQ(serial.max_legacy_idx(), parallel.max_legacy_idx());
+    for (int idx = 0; idx <= serial.max_legacy_idx(); ++idx) {
+        EXPECT_EQ(serial.is_nucleotide(idx), parallel.is_nucleotide(idx));
+        EXPECT_EQ(serial.rmsd(idx), parallel.rmsd(idx));
+    }
+}
+
+TEST(NucleotideEligibilityTest, BaseRingNeedsNoLegacyIndex) {
+    const Structure structure = make_structure();
+    const auto& residues = structure.chains()[0].residues();
+    EXPECT_TRUE(NucleotideEligibility::has_base_ring(residues[0]));
+    EXPECT_TRUE(NucleotideEligibility::has_base_ring(residues[1]));
+    EXPECT_TRUE(NucleotideEligibility::has_base_ring(residues[2]));
+    EXPECT_FALSE(NucleotideEligibility::has_base_ring(residues[3]));
+
+    // Decided from the atoms alone, before legacy indices are assigned
+    const Residue unindexed =
+        make_residue("XYZ", 0, unknown_base(), standard_ring_atoms([](const Vector3D& p) { return p; }));
+    EXPECT_TRUE(NucleotideEligibility::has_base_ring(unindexed));
+}
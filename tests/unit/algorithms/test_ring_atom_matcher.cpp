@@ -177,3 +177,40 @@ TEST_F(RingAtomMatcherTest, GetRingAtomNames) {
     }
     EXPECT_FALSE(has_c1_prime) << "C1' should not be in ring atom names (it's a sugar atom, not a ring atom)";
 }
+
+// The AtomType-indexed ring template must match the same pairs, in the same order, as the name search
+TEST_F(RingAtomMatcherTest, RingTemplateMatchesNameSearch) {
+    RingTemplate ring_template;
+    for (const auto& atom : standard_template_.chains()[0].residues()[0].atoms()) {
+        if (is_ring_atom(atom.atom_type())) {
+            ring_template.coords[static_cast<size_t>(atom.atom_type())] = atom.position();
+            ring_template.present[static_cast<size_t>(atom.atom_type())] = true;
+        }
+    }
+
+    Residue incomplete_residue("  A", 1, "A");
+    incomplete_residue.add_atom(Atom(" N9 ", Vector3D(0.0, 0.0, 1.0)));
+    incomplete_residue.add_atom(Atom(" C4 ", Vector3D(0.0, 0.0, 0.0)));
+    incomplete_residue.add_atom(Atom(" C4 ", Vector3D(9.0, 9.0, 9.0)));
+    incomplete_residue.add_atom(Atom(" N3 ", Vector3D(1.0, 0.0, 0.0)));
+    incomplete_residue.add_atom(Atom(" C6 ", Vector3D(4.0, 0.0, 0.0)));
+
+    for (const Residue* residue : {&experimental_residue_, &incomplete_residue}) {
+        for (BaseType type : {BaseType::ADENINE, BaseType::URACIL}) {
+            const MatchedAtoms expected = RingAtomMatcher::match(*residue, standard_template_, type);
+
+            std::vector<std::string> names;
+            std::vector<Vector3D> standard;
+            std::vector<Vector3D> experimental;
+            const size_t num_matched = RingAtomMatcher::match(*residue, ring_template, type, names, standard,
+                                                              experimental);
+
+            ASSERT_EQ(num_matched, expected.num_matched);
+            EXPECT_EQ(names, expected.atom_names);
+            for (size_t i = 0; i < num_matched; ++i) {
+                EXPECT_EQ(standard[i], expected.standard[i].position()) << names[i];
+                EXPECT_EQ(experimental[i], expected.experimental[i].position()) << names[i];
+            }
+        }
+    }
+}
@@ -4,10 +4,16 @@
  */
 
 #include <gtest/gtest.h>
+#include <x3dna/algorithms/hydrogen_bond/edge_classifier.hpp>
 #include <x3dna/algorithms/hydrogen_bond/role_classifier.hpp>
+#include <x3dna/algorithms/pair_identification/base_pair_validator.hpp>
+#include <string>
+#include <vector>
 
 using namespace x3dna::algorithms;
 using namespace x3dna::core;
+using x3dna::algorithms::hydrogen_bond::EdgeClassifier;
+using x3dna::geometry::Vector3D;
 
 // ============================================================================
 // Nucleotide atom role tests
@@ -260,3 +266,43 @@ TEST(RoleClassifierTest, LegacyCompatibility) {
     auto class2 = HBondRoleClassifier::classify_nucleotide_bond('A', 'G', " N1 ", " N2 ");
     EXPECT_EQ(class1, class2);
 }
+
+// ============================================================================
+// AtomType table tests
+// ============================================================================
+
+TEST(RoleClassifierTest, AtomTypeTablesMatchNameLookups) {
+    // Every nucleotide atom type, both phosphate spellings, and atoms the tables do not cover
+    const std::vector<std::string> names = {"C4",  "N3",  "C2",  "N1",  "C6",  "C5",  "N7",  "C8",  "N9",
+                                            "O6",  "N6",  "O2",  "N2",  "O4",  "N4",  "C5M", "C7",  "C1'",
+                                            "C2'", "C3'", "C4'", "C5'", "O2'", "O3'", "O4'", "O5'", "P",
+                                            "O1P", "O2P", "OP1", "OP2", "OP3", "N",   "O",   "OG",  "S4"};
+    const std::string bases = "ACGITUacgituPX?";
+
+    std::vector<Atom> atoms;
+    for (const auto& name : names) {
+        atoms.emplace_back(name, Vector3D(0.0, 0.0, 0.0));
+    }
+
+    for (char base : bases) {
+        for (const auto& atom : atoms) {
+            EXPECT_EQ(HBondRoleClassifier::get_nucleotide_atom_role(base, atom),
+                      HBondRoleClassifier::get_nucleotide_atom_role(base, atom.name()))
+                << base << " " << atom.name();
+            EXPECT_EQ(EdgeClassifier::classify(atom, base), EdgeClassifier::classify(atom.name(), base))
+                << base << " " << atom.name();
+        }
+    }
+
+    for (char base1 : bases) {
+        for (char base2 : std::string("AGUP")) {
+            for (const auto& atom1 : atoms) {
+                for (const auto& atom2 : atoms) {
+                    EXPECT_EQ(BasePairValidator::donor_acceptor(base1, base2, atom1, atom2),
+                              BasePairValidator::donor_acceptor(base1, base2, atom1.name(), atom2.name()))
+                        << base1 << base2 << " " << atom1.name() << " " << atom2.name();
+                }
+            }
+        }
+    }
+}
@@ -8,7 +8,13 @@
 #include <x3dna/algorithms/hydrogen_bond/slot/atom_capacity.hpp>
 #include <x3dna/algorithms/hydrogen_bond/slot/hbond_candidate.hpp>
 #include <x3dna/algorithms/hydrogen_bond/slot/slot_optimizer_params.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_predictor.hpp>
+#include <x3dna/algorithms/hydrogen_bond/slot/slot_store.hpp>
+#include <x3dna/core/reference_frame.hpp>
+#include <x3dna/core/residue.hpp>
+#include <x3dna/geometry/matrix3d.hpp>
 #include <cmath>
+#include <vector>
 
 using namespace x3dna::algorithms::hydrogen_bond::slot;
 using namespace x3dna::geometry;
@@ -266,3 +272,53 @@ TEST(SlotOptimizerParamsTest, StrictParams) {
     EXPECT_EQ(params.min_bifurcation_alignment, 0.7);
     EXPECT_FALSE(params.baseline_mode);
 }
+
+// ============================================================================
+// SlotStore tests
+// ============================================================================
+
+TEST(SlotStoreTest, FrameLocalSlotsMatchPrediction) {
+    // Guanine base, rotated away from the axes, with a reference frame
+    const Matrix3D rotation = Matrix3D::rotation_z(0.7) * Matrix3D::rotation_x(0.3);
+    x3dna::core::Residue residue("G", 1, "A");
+    const std::vector<std::pair<std::string, Vector3D>> atoms = {
+        {"C4", Vector3D(-1.267, 3.124, 0.0)}, {"N3", Vector3D(-2.320, 2.290, 0.0)},
+        {"C2", Vector3D(-1.912, 1.023, 0.0)}, {"N1", Vector3D(-0.668, 0.532, 0.0)},
+        {"C6", Vector3D(0.369, 1.398, 0.0)},  {"C5", Vector3D(0.071, 2.771, 0.0)},
+        {"N7", Vector3D(0.877, 3.902, 0.0)},  {"C8", Vector3D(0.024, 4.897, 0.0)},
+        {"N9", Vector3D(-1.291, 4.498, 0.0)}, {"O6", Vector3D(1.611, 1.054, 0.0)},
+        {"N2", Vector3D(-2.949, 0.139, 0.0)}};
+    for (const auto& [name, position] : atoms) {
+        residue.add_atom(x3dna::core::Atom(name, rotation * position));
+    }
+    residue.set_reference_frame(x3dna::core::ReferenceFrame(rotation, Vector3D(0.0, 0.0, 0.0)));
+
+    SlotStore store;
+    store.assign({&residue});
+    ASSERT_EQ(store.num_residues(), 1u);
+
+    const Vector3D normal = SlotPredictor::compute_base_normal(residue);
+    std::vector<HSlot> h_slots;
+    std::vector<LPSlot> lp_slots;
+    for (size_t i = 0; i < residue.num_atoms(); ++i) {
+        const std::string& name = residue.atoms()[i].name();
+        const auto expected_h = SlotPredictor::predict_h_slots('G', name, residue, normal);
+        store.h_slots(0, i, h_slots);
+        ASSERT_EQ(h_slots.size(), expected_h.size()) << name;
+        for (size_t k = 0; k < h_slots.size(); ++k) {
+            EXPECT_NEAR((h_slots[k].direction() - expected_h[k].direction()).length(), 0.0, 1e-12) << name;
+            EXPECT_EQ(h_slots[k].max_bonds(), expected_h[k].max_bonds()) << name;
+        }
+
+        const auto expected_lp = SlotPredictor::predict_lp_slots('G', name, residue, normal);
+        store.lp_slots(0, i, lp_slots);
+        ASSERT_EQ(lp_slots.size(), expected_lp.size()) << name;
+        for (size_t k = 0; k < lp_slots.size(); ++k) {
+            EXPECT_NEAR((lp_slots[k].direction() - expected_lp[k].direction()).length(), 0.0, 1e-12) << name;
+        }
+    }
+
+    // Buffers are reused across structures
+    store.clear();
+    EXPECT_EQ(store.num_residues(), 0u);
+}
@@ -245,3 +245,45 @@ TEST_F(AtomTest, TrimmedNameComparisons) {
     EXPECT_EQ(atom1.name(), atom2.name());
     EXPECT_EQ(atom1.name(), "N1");
 }
+
+// Interned names back the compact atom layout; IDs are stable and strings never move
+TEST(InternedNamesTest, InternReturnsStableIds) {
+    EXPECT_EQ(InternedNames::intern(""), 0);
+    EXPECT_EQ(InternedNames::name(0), "");
+
+    const auto c1 = InternedNames::intern("C1'");
+    const std::string& c1_name = InternedNames::name(c1);
+    EXPECT_EQ(c1_name, "C1'");
+    EXPECT_EQ(InternedNames::intern(std::string("C1'")), c1);
+
+    // Enough new names to allocate further chunks without moving earlier strings
+    for (int i = 0; i < 600; ++i) {
+        const std::string name = "X" + std::to_string(i);
+        EXPECT_EQ(InternedNames::name(InternedNames::intern(name)), name);
+    }
+    EXPECT_EQ(&InternedNames::name(c1), &c1_name);
+    EXPECT_GE(InternedNames::size(), 602u);
+}
+
+TEST_F(AtomTest, BuilderKeepsAllFields) {
+    Atom atom = Atom::create(" OP1", Vector3D(1.5, -2.25, 3.0))
+                    .alt_loc('B')
+                    .occupancy(0.5)
+                    .atom_serial(1234)
+                    .model_number(7)
+                    .b_factor(42.5)
+                    .element("O")
+                    .legacy_atom_idx(99)
+                    .build();
+
+    EXPECT_EQ(atom.name(), "OP1");
+    EXPECT_EQ(atom.element(), "O");
+    EXPECT_EQ(atom.position(), Vector3D(1.5, -2.25, 3.0));
+    EXPECT_EQ(atom.alt_loc(), 'B');
+    EXPECT_DOUBLE_EQ(atom.occupancy(), 0.5);
+    EXPECT_EQ(atom.atom_serial(), 1234);
+    EXPECT_EQ(atom.model_number(), 7);
+    EXPECT_DOUBLE_EQ(atom.b_factor(), 42.5);
+    EXPECT_EQ(atom.legacy_atom_idx(), 99);
+    EXPECT_EQ(atom.atom_type(), AtomType::OP1);
+}
@@ -208,3 +208,37 @@ TEST_F(StructureTest, MultipleResiduesPerChain) {
     EXPECT_EQ(structure.num_residues(), 5);
     EXPECT_EQ(structure.num_atoms(), 5);
 }
+
+// Legacy order cache tests
+TEST_F(StructureTest, LegacyIndexCacheFollowsMutations) {
+    // Chain B's residue comes first in legacy order; chain A leaves a gap at index 2
+    structure_[0].residues()[0].set_legacy_residue_idx(3);
+    structure_[0].residues()[1].set_legacy_residue_idx(4);
+    structure_[1].residues()[0].set_legacy_residue_idx(1);
+
+    const auto& order = structure_.residues_in_legacy_order();
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order[0]->chain_id(), "B");
+    EXPECT_EQ(order[1]->legacy_residue_idx(), 3);
+    EXPECT_EQ(order[2]->legacy_residue_idx(), 4);
+
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(1), order[0]);
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(2), nullptr);
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(4), order[2]);
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(5), nullptr);
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(0), nullptr);
+
+    // Adding a chain drops the cache
+    Chain chain_c("C");
+    Residue u1("  U", 1, "C");
+    u1.set_legacy_residue_idx(2);
+    chain_c.add_residue(u1);
+    structure_.add_chain(chain_c);
+    ASSERT_NE(structure_.get_residue_by_legacy_idx(2), nullptr);
+    EXPECT_EQ(structure_.get_residue_by_legacy_idx(2)->chain_id(), "C");
+    EXPECT_EQ(structure_.residues_in_legacy_order().size(), 4);
+
+    // A copy indexes its own residues
+    const Structure copy = structure_;
+    EXPECT_EQ(copy.get_residue_by_legacy_idx(1), &copy.chains()[1].residues()[0]);
+}
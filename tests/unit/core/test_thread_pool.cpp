@@ -0,0 +1,78 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Unit tests for ThreadPool
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/core/thread_pool.hpp>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace x3dna::core;
+
+TEST(ThreadPoolTest, RunsEveryTaskExactlyOnce) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.num_threads(), 4u);
+
+    std::vector<std::atomic<int>> hits(1000);
+    std::vector<size_t> workers(hits.size());
+    pool.parallel_for(hits.size(), [&](size_t task, size_t worker) {
+        hits[task].fetch_add(1);
+        workers[task] = worker;
+    });
+
+    for (size_t i = 0; i < hits.size(); ++i) {
+        EXPECT_EQ(hits[i].load(), 1) << "task " << i;
+        EXPECT_LT(workers[i], pool.num_threads());
+    }
+}
+
+TEST(ThreadPoolTest, ReusableAcrossCalls) {
+    ThreadPool pool(3);
+    for (size_t round = 0; round < 20; ++round) {
+        std::vector<size_t> out(round * 7);
+        pool.parallel_for(out.size(), [&](size_t task, size_t) { out[task] = task * task; });
+        for (size_t i = 0; i < out.size(); ++i) {
+            EXPECT_EQ(out[i], i * i);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, SingleThreadRunsInline) {
+    ThreadPool pool(1);
+    std::vector<size_t> order;
+    pool.parallel_for(5, [&](size_t task, size_t worker) {
+        EXPECT_EQ(worker, 0u);
+        order.push_back(task);
+    });
+    std::vector<size_t> expected(5);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(order, expected);
+}
+
+TEST(ThreadPoolTest, RethrowsTaskException) {
+    ThreadPool pool(4);
+    std::atomic<int> completed{0};
+    EXPECT_THROW(pool.parallel_for(100,
+                                   [&](size_t task, size_t) {
+                                       if (task == 42) {
+                                           throw std::runtime_error("task failed");
+                                       }
+                                       completed.fetch_add(1);
+                                   }),
+                 std::runtime_error);
+    EXPECT_EQ(completed.load(), 99);
+
+    // Pool remains usable after an exception
+    std::atomic<int> count{0};
+    pool.parallel_for(10, [&](size_t, size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 10);
+}
+
+TEST(ThreadPoolTest, ResolveThreadCount) {
+    EXPECT_EQ(ThreadPool::resolve_thread_count(3), 3u);
+    EXPECT_GE(ThreadPool::resolve_thread_count(0), 1u);
+    EXPECT_GE(ThreadPool::resolve_thread_count(-1), 1u);
+}
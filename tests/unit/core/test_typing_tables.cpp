@@ -0,0 +1,175 @@
+/**
+ * @file test_typing_tables.cpp
+ * @brief Equivalence tests for the generated perfect-hash typing tables
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <nlohmann/json.hpp>
+#include <x3dna/config/resource_locator.hpp>
+#include <x3dna/core/typing/type_registry.hpp>
+#include <x3dna/core/typing/typing_tables_generated.hpp>
+
+using namespace x3dna::core::typing;
+using nlohmann::json;
+
+namespace {
+
+json load_config(const std::string& filename) {
+    std::ifstream file(x3dna::config::ResourceLocator::config_file(filename));
+    return json::parse(file);
+}
+
+// to_string(AtomType) spells primes as in PDB names: "C1_PRIME" -> "C1'"
+std::string atom_type_name(const json& enum_name) {
+    std::string name = enum_name.get<std::string>();
+    const auto pos = name.find("_PRIME");
+    return pos == std::string::npos ? name : name.substr(0, pos) + "'";
+}
+
+} // namespace
+
+// Lookups are usable in constant expressions
+static_assert(tables::find_atom_name("C1'") != nullptr);
+static_assert(tables::find_atom_name("C1'")->nucleotide_type == AtomType::C1_PRIME);
+static_assert(tables::find_atom_name("C1*") == nullptr);
+static_assert(tables::find_residue_name("HOH") != nullptr);
+
+class TypingTablesTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // TypeRegistry initializes the resource locator on first use
+        registry_ = &TypeRegistry::instance();
+    }
+
+    const TypeRegistry* registry_ = nullptr;
+};
+
+TEST_F(TypingTablesTest, AtomTypesMatchStandardTypesJson) {
+    const json standard = load_config("standard_types.json");
+    const auto& atom_types = standard["atom_types"];
+
+    const std::pair<const char*, MoleculeType> molecules[] = {
+        {"nucleotide", MoleculeType::NUCLEIC_ACID},
+        {"protein", MoleculeType::PROTEIN},
+        {"water", MoleculeType::WATER},
+    };
+    for (const auto& [key, molecule_type] : molecules) {
+        for (const auto& [name, type_name] : atom_types[key].items()) {
+            EXPECT_EQ(to_string(AtomClassifier::get_atom_type(name, molecule_type)), atom_type_name(type_name))
+                << key << " atom " << name;
+        }
+    }
+
+    // Without a molecule type the nucleotide map wins, then protein, then water
+    for (const auto& molecule : {"water", "protein", "nucleotide"}) {
+        for (const auto& [name, type_name] : atom_types[molecule].items()) {
+            std::string expected = atom_type_name(type_name);
+            if (atom_types["nucleotide"].contains(name)) {
+                expected = atom_type_name(atom_types["nucleotide"][name]);
+            } else if (atom_types["protein"].contains(name)) {
+                expected = atom_type_name(atom_types["protein"][name]);
+            }
+            EXPECT_EQ(to_string(AtomClassifier::get_atom_type(name)), expected) << name;
+        }
+    }
+
+    for (const auto& name : {"", "C1*", "HO2'", "N10", "ZN", "op1"}) {
+        EXPECT_EQ(AtomClassifier::get_atom_type(name), AtomType::UNKNOWN) << name;
+    }
+}
+
+TEST_F(TypingTablesTest, AtomLocationsMatchStandardTypesJson) {
+    const json standard = load_config("standard_types.json");
+    const auto& locations = standard["atom_locations"];
+
+    std::set<std::string> names;
+    for (const auto& [location, members] : locations.items()) {
+        for (const auto& name : members) {
+            names.insert(name.get<std::string>());
+        }
+    }
+    for (const auto& [name, type_name] : standard["atom_types"]["protein"].items()) {
+        names.insert(name);
+    }
+    names.insert({"", "C1*", "OP3", "N10"});
+
+    auto listed = [&locations](const char* location, const std::string& name) {
+        const auto& members = locations[location];
+        return std::find(members.begin(), members.end(), name) != members.end();
+    };
+    for (const auto& name : names) {
+        EXPECT_EQ(AtomClassifier::is_backbone_atom(name), listed("backbone", name)) << name;
+        EXPECT_EQ(AtomClassifier::is_sugar_atom(name), listed("sugar", name)) << name;
+        EXPECT_EQ(AtomClassifier::is_ring_atom(name), listed("ring", name)) << name;
+        EXPECT_EQ(AtomClassifier::is_mainchain_atom(name), listed("mainchain", name)) << name;
+    }
+}
+
+TEST_F(TypingTablesTest, NucleotidesMatchRuntimeRegistry) {
+    // The shipped modified_nucleotides.json is the one the tables were generated from
+    EXPECT_TRUE(registry_->uses_nucleotide_table());
+
+    const json nucleotides = load_config("modified_nucleotides.json");
+    size_t checked = 0;
+    for (const auto& [category, entries] : nucleotides["modified_nucleotides"].items()) {
+        for (const auto& [name, entry] : entries.items()) {
+            const auto info = registry_->get_nucleotide_info(name);
+            ASSERT_TRUE(info.has_value()) << name;
+
+            const auto classification = registry_->classify_residue(name);
+            EXPECT_EQ(classification.molecule_type, registry_->is_water(name) ? MoleculeType::WATER
+                                                                              : MoleculeType::NUCLEIC_ACID)
+                << name;
+            if (classification.molecule_type != MoleculeType::NUCLEIC_ACID) {
+                continue;
+            }
+            EXPECT_EQ(classification.one_letter_code, info->one_letter_code) << name;
+            EXPECT_EQ(classification.base_type, info->base_type) << name;
+            EXPECT_EQ(classification.is_purine(), info->is_purine) << name;
+            EXPECT_EQ(classification.is_modified_nucleotide, info->is_modified) << name;
+            EXPECT_TRUE(registry_->is_nucleotide(name)) << name;
+            ++checked;
+        }
+    }
+    EXPECT_GT(checked, 0u);
+}
+
+TEST_F(TypingTablesTest, OtherResiduesMatchStandardTypesJson) {
+    const json standard = load_config("standard_types.json");
+
+    for (const auto& name : standard["waters"]) {
+        const auto classification = registry_->classify_residue(name.get<std::string>());
+        EXPECT_EQ(classification.molecule_type, MoleculeType::WATER) << name;
+        EXPECT_TRUE(registry_->is_water(name.get<std::string>())) << name;
+    }
+
+    for (const auto& [name, entry] : standard["amino_acids"].items()) {
+        const auto info = registry_->get_amino_acid_info(name);
+        ASSERT_TRUE(info.has_value()) << name;
+        EXPECT_EQ(std::string(1, info->one_letter_code), entry["code"].get<std::string>()) << name;
+        EXPECT_EQ(to_string(info->category), entry["category"].get<std::string>()) << name;
+        EXPECT_TRUE(registry_->is_amino_acid(name)) << name;
+        if (!registry_->is_nucleotide(name)) {
+            const auto classification = registry_->classify_residue(name);
+            EXPECT_EQ(classification.molecule_type, MoleculeType::PROTEIN) << name;
+            EXPECT_EQ(classification.amino_acid_type, info->type) << name;
+            EXPECT_EQ(classification.one_letter_code, info->one_letter_code) << name;
+        }
+    }
+
+    for (const auto& [name, ion_name] : standard["ions"].items()) {
+        EXPECT_TRUE(registry_->is_ion(name)) << name;
+        EXPECT_EQ(to_string(registry_->get_ion_type(name)), ion_name.get<std::string>()) << name;
+        if (!registry_->is_nucleotide(name) && !registry_->is_amino_acid(name)) {
+            EXPECT_EQ(registry_->classify_residue(name).molecule_type, MoleculeType::ION) << name;
+        }
+    }
+
+    for (const auto& name : {"", "XYZ", "HEM", "hoh", "ALA "}) {
+        EXPECT_EQ(tables::find_residue_name(name), nullptr) << name;
+        EXPECT_EQ(registry_->classify_residue(name).molecule_type, MoleculeType::LIGAND) << name;
+    }
+}
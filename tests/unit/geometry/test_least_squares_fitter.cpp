@@ -8,6 +8,8 @@
 #include <x3dna/geometry/vector3d.hpp>
 #include <x3dna/geometry/matrix3d.hpp>
 #include <cmath>
+#include <random>
+#include <vector>
 
 using namespace x3dna::geometry;
 
@@ -287,3 +289,53 @@ TEST_F(LeastSquaresFitterTest, IdentityTransformation) {
     // RMS should be zero
     EXPECT_NEAR(result.rms, 0.0, TOLERANCE);
 }
+
+// Batch fits must reproduce single fits exactly, whatever the mix of block sizes
+TEST_F(LeastSquaresFitterTest, BatchMatchesSingleFits) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> coord(-5.0, 5.0);
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+    std::uniform_int_distribution<size_t> count(3, LeastSquaresFitter::MAX_BLOCK_POINTS);
+
+    std::vector<LeastSquaresFitter::PointBlock> blocks(50);
+    for (auto& block : blocks) {
+        const Matrix3D rot = Matrix3D::rotation_z(angle(rng)) * Matrix3D::rotation_x(angle(rng));
+        const Vector3D trans(coord(rng), coord(rng), coord(rng));
+        const size_t n = count(rng);
+        for (size_t k = 0; k < n; ++k) {
+            const Vector3D p(coord(rng), coord(rng), coord(rng));
+            const Vector3D noise(0.01 * coord(rng), 0.01 * coord(rng), 0.01 * coord(rng));
+            block.add(p, rot * p + trans + noise);
+        }
+    }
+
+    std::vector<LeastSquaresFitter::FitResult> results;
+    fitter_->fit_batch(blocks, results);
+    ASSERT_EQ(results.size(), blocks.size());
+
+    for (size_t r = 0; r < blocks.size(); ++r) {
+        const auto& block = blocks[r];
+        const std::vector<Vector3D> points1(block.points1.begin(), block.points1.begin() + block.count);
+        const std::vector<Vector3D> points2(block.points2.begin(), block.points2.begin() + block.count);
+        const auto single = LeastSquaresFitter().fit(points1, points2);
+
+        EXPECT_EQ(results[r].rms, single.rms) << "block " << r;
+        EXPECT_EQ(results[r].translation.x(), single.translation.x());
+        EXPECT_EQ(results[r].translation.y(), single.translation.y());
+        EXPECT_EQ(results[r].translation.z(), single.translation.z());
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                EXPECT_EQ(results[r].rotation.at(i, j), single.rotation.at(i, j));
+            }
+        }
+    }
+}
+
+TEST_F(LeastSquaresFitterTest, BatchRejectsSmallBlocks) {
+    std::vector<LeastSquaresFitter::PointBlock> blocks(1);
+    blocks[0].add(Vector3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0));
+    blocks[0].add(Vector3D(1.0, 0.0, 0.0), Vector3D(2.0, 0.0, 0.0));
+
+    std::vector<LeastSquaresFitter::FitResult> results;
+    EXPECT_THROW(fitter_->fit_batch(blocks, results), std::invalid_argument);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file test_qcp_rmsd.cpp
+ * @brief Tests for the RMSD-only superposition routine
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/geometry/qcp_rmsd.hpp>
+#include <x3dna/geometry/least_squares_fitter.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace x3dna::geometry;
+
+// Must agree with the RMS of the full least-squares fit, from perfect to poor superpositions
+TEST(QcpRmsdTest, MatchesLeastSquaresFitter) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coord(-5.0, 5.0);
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+    std::uniform_int_distribution<size_t> count(3, 12);
+    const double noise_levels[] = {0.0, 0.01, 0.3, 2.0};
+
+    for (int trial = 0; trial < 200; ++trial) {
+        const Matrix3D rot = Matrix3D::rotation_z(angle(rng)) * Matrix3D::rotation_y(angle(rng));
+        const Vector3D trans(coord(rng), coord(rng), coord(rng));
+        const double noise = noise_levels[trial % 4];
+
+        std::vector<Vector3D> points1;
+        std::vector<Vector3D> points2;
+        const size_t n = count(rng);
+        for (size_t k = 0; k < n; ++k) {
+            const Vector3D p(coord(rng), coord(rng), coord(rng));
+            points1.push_back(p);
+            points2.push_back(rot * p + trans + Vector3D(coord(rng), coord(rng), coord(rng)) * (noise / 5.0));
+        }
+
+        const auto rmsd = superposition_rmsd(points1, points2);
+        ASSERT_TRUE(rmsd.has_value());
+        const double expected = LeastSquaresFitter().fit(points1, points2).rms;
+        EXPECT_NEAR(*rmsd, expected, 1e-6) << "trial " << trial << " n " << n;
+    }
+}
+
+TEST(QcpRmsdTest, RejectsTooFewOrMismatchedPoints) {
+    const std::vector<Vector3D> two = {Vector3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0)};
+    const std::vector<Vector3D> three = {Vector3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0)};
+
+    EXPECT_FALSE(superposition_rmsd(two, two).has_value());
+    EXPECT_FALSE(superposition_rmsd(two, three).has_value());
+
+    LeastSquaresFitter::PointBlock block;
+    EXPECT_FALSE(superposition_rmsd(block).has_value());
+    for (const auto& p : three) {
+        block.add(p, p);
+    }
+    ASSERT_TRUE(superposition_rmsd(block).has_value());
+    EXPECT_NEAR(*superposition_rmsd(block), 0.0, 1e-7);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_spatial_grid.cpp
+ * @brief Tests for SpatialGrid cell list
+ */
+
+#include <gtest/gtest.h>
+#include <x3dna/geometry/spatial_grid.hpp>
+#include <x3dna/geometry/vector3d.hpp>
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace x3dna::geometry;
+
+namespace {
+
+std::vector<Vector3D> random_points(size_t n, double box, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-box, box);
+    std::vector<Vector3D> points;
+    points.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        points.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    return points;
+}
+
+// Every point within radius must be among the grid candidates
+void expect_covers_brute_force(const std::vector<Vector3D>& points, double radius) {
+    SpatialGrid grid(points, radius);
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < points.size(); ++i) {
+        grid.candidates_near(points[i], candidates);
+        std::set<size_t> found(candidates.begin(), candidates.end());
+        EXPECT_EQ(found.size(), candidates.size()) << "duplicate candidate for point " << i;
+        for (size_t j = 0; j < points.size(); ++j) {
+            if (points[i].distance_to(points[j]) <= radius) {
+                EXPECT_TRUE(found.count(j)) << "missed neighbor " << j << " of " << i;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(SpatialGridTest, EmptyGrid) {
+    std::vector<Vector3D> points;
+    SpatialGrid grid(points, 15.0);
+    std::vector<size_t> candidates{1, 2, 3};
+    grid.candidates_near(Vector3D(0, 0, 0), candidates);
+    EXPECT_TRUE(candidates.empty());
+    EXPECT_EQ(grid.size(), 0u);
+}
+
+TEST(SpatialGridTest, MatchesBruteForceDense) {
+    expect_covers_brute_force(random_points(500, 30.0, 1), 15.0);
+}
+
+TEST(SpatialGridTest, MatchesBruteForceSparse) {
+    // Large box forces the cell-count cap to widen cells
+    expect_covers_brute_force(random_points(300, 5000.0, 2), 15.0);
+}
+
+TEST(SpatialGridTest, PointsExactlyAtRadius) {
+    std::vector<Vector3D> points;
+    for (int i = 0; i < 20; ++i) {
+        points.emplace_back(15.0 * i, 0.0, 0.0);
+    }
+    expect_covers_brute_force(points, 15.0);
+}
+
+TEST(SpatialGridTest, DegenerateRadiusReturnsAll) {
+    auto points = random_points(50, 10.0, 3);
+    SpatialGrid grid(points, 0.0);
+    std::vector<size_t> candidates;
+    grid.candidates_near(points[0], candidates);
+    EXPECT_EQ(candidates.size(), points.size());
+}
+
+TEST(SpatialGridTest, FarPointsExcluded) {
+    std::vector<Vector3D> points = {Vector3D(0, 0, 0), Vector3D(1, 0, 0), Vector3D(100, 0, 0), Vector3D(0, 100, 0)};
+    SpatialGrid grid(points, 5.0);
+    std::vector<size_t> candidates;
+    grid.candidates_near(points[0], candidates);
+    std::sort(candidates.begin(), candidates.end());
+    EXPECT_EQ(candidates, (std::vector<size_t>{0, 1}));
+}
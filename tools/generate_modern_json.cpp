@@ -171,7 +171,7 @@ BaseFrameCalculator setup_frame_calculator(const std::filesystem::path& template
 bool process_single_pdb(const std::filesystem::path& pdb_file, const std::filesystem::path& json_output_dir,
                         const std::string& stage, bool use_chain_order = false, bool verbose = true,
                         bool use_dssr_filter = false, bool use_dssr_tight = false, bool use_dssr_strict = false,
-                        bool use_scored_occupancy = false, int max_bonds_per_atom = 2) {
+                        bool use_scored_occupancy = false, int max_bonds_per_atom = 2, int num_threads = 1) {
     try {
         // Create output directory if needed
         std::filesystem::create_directories(json_output_dir);
@@ -257,6 +257,7 @@ bool process_single_pdb(const std::filesystem::path& pdb_file, const std::filesy
             // Use DSSR-like parameters (4.0Å cutoff) for better comparison
             auto params = x3dna::algorithms::HBondDetectionParams::dssr_like();
             x3dna::algorithms::hydrogen_bond::HBondDetector hb_detector(params);
+            hb_detector.set_num_threads(num_threads);
             auto result = hb_detector.detect_all_structure_hbonds(structure);
 
             // Apply DSSR-style filtering if enabled
@@ -306,9 +307,11 @@ bool process_single_pdb(const std::filesystem::path& pdb_file, const std::filesy
             JsonWriter writer(pdb_file);
             writer.record_residue_indices(structure);
             BaseFrameCalculator calculator = setup_frame_calculator("data/templates", structure, verbose);
+            calculator.set_num_threads(num_threads);
             calculator.calculate_all_frames(structure);
 
             BasePairFinder finder;
+            finder.set_num_threads(num_threads);
             auto base_pairs = finder.find_pairs_with_recording(structure, &writer);
             // Note: find_pairs_with_recording already records base_pairs internally
 
@@ -441,6 +444,7 @@ void print_usage(const char* prog_name) {
     std::cerr << "  --dssr-strict       Use strictest thresholds (3.4Å for N-containing)\n";
     std::cerr << "  --scored-occupancy  Apply scoring-based occupancy filter (keeps best bonds per atom)\n";
     std::cerr << "  --max-bonds=N       Max bonds per atom for occupancy filter (default: 2)\n";
+    std::cerr << "  --threads=N         Worker threads for frames, pairs and all_hbonds (default: 1, 0 = all cores)\n";
     std::cerr << "  --progress=FILE     Progress file (default: <output_dir>/progress.json)\n";
     std::cerr << "  --resume            Resume from progress file\n";
     std::cerr << "  --max=N             Maximum PDBs to process\n";
@@ -477,6 +481,7 @@ int main(int argc, char* argv[]) {
     bool use_dssr_strict = false;
     bool use_scored_occupancy = false;
     int max_bonds_per_atom = 2;
+    int num_threads = 1;
     int max_pdbs = -1;
     std::string single_pdb_file;
 
@@ -509,6 +514,8 @@ int main(int argc, char* argv[]) {
             use_scored_occupancy = true;
         } else if (arg.find("--max-bonds=") == 0) {
             max_bonds_per_atom = std::stoi(arg.substr(12));
+        } else if (arg.find("--threads=") == 0) {
+            num_threads = std::stoi(arg.substr(10));
         } else if (arg == "--resume") {
             resume = true;
         } else if (arg == "--quiet" || arg == "-q") {
@@ -565,7 +572,8 @@ int main(int argc, char* argv[]) {
         std::cout << "\n";
 
         bool success = process_single_pdb(single_pdb_file, output_dir, stage, use_chain_order, !quiet,
-                                          use_dssr_filter, use_dssr_tight, use_dssr_strict, use_scored_occupancy, max_bonds_per_atom);
+                                          use_dssr_filter, use_dssr_tight, use_dssr_strict, use_scored_occupancy, max_bonds_per_atom,
+                                          num_threads);
 
         if (success) {
             std::cout << "\n✅ Success!\n";
@@ -669,7 +677,8 @@ int main(int argc, char* argv[]) {
         }
 
         bool success = process_single_pdb(pdb_path, output_dir, stage, use_chain_order, !quiet,
-                                          use_dssr_filter, use_dssr_tight, use_dssr_strict, use_scored_occupancy, max_bonds_per_atom);
+                                          use_dssr_filter, use_dssr_tight, use_dssr_strict, use_scored_occupancy, max_bonds_per_atom,
+                                          num_threads);
 
         processed++;
         if (success) {